@@ -18,15 +18,31 @@
  *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
  ***************************************************************************/
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 
+#if !defined( _WIN32 ) && !defined( TARGET_PS_VITA ) && !defined( TARGET_NINTENDO_SWITCH )
+#define AGG_FILE_MEMORY_MAPPING
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include "agg_file.h"
 
 namespace fheroes2
 {
+    AGGFile::~AGGFile()
+    {
+        _unmapFile();
+    }
+
     bool AGGFile::open( const std::string & fileName )
     {
+        _unmapFile();
+        _files.clear();
+
         if ( !_stream.open( fileName, "rb" ) )
             return false;
 
@@ -42,32 +58,89 @@ namespace fheroes2
         _stream.seek( size - nameEntriesSize );
         StreamBuf nameEntries = _stream.toStreamBuf( nameEntriesSize );
 
+        _files.reserve( count );
+
         for ( size_t i = 0; i < count; ++i ) {
-            std::string name = nameEntries.toString( _maxFilenameSize );
+            FileEntry & entry = _files.emplace_back();
+            entry.name = nameEntries.toString( _maxFilenameSize );
             fileEntries.getLE32(); // skip CRC (?) part
-            const uint32_t fileOffset = fileEntries.getLE32();
-            const uint32_t fileSize = fileEntries.getLE32();
-            _files.try_emplace( std::move( name ), std::make_pair( fileSize, fileOffset ) );
+            entry.offset = fileEntries.getLE32();
+            entry.size = fileEntries.getLE32();
         }
+
+        std::stable_sort( _files.begin(), _files.end(), []( const FileEntry & first, const FileEntry & second ) { return first.name < second.name; } );
+        _files.erase( std::unique( _files.begin(), _files.end(), []( const FileEntry & first, const FileEntry & second ) { return first.name == second.name; } ),
+                      _files.end() );
+
         if ( _files.size() != count ) {
             _files.clear();
             return false;
         }
-        return !_stream.fail();
+
+        if ( _stream.fail() ) {
+            return false;
+        }
+
+        _mapFile( fileName, size );
+
+        return true;
     }
 
-    std::vector<uint8_t> AGGFile::read( const std::string & fileName )
+    AGGFileData AGGFile::read( const std::string & fileName )
     {
-        auto it = _files.find( fileName );
-        if ( it != _files.end() ) {
-            const auto & fileParams = it->second;
-            if ( fileParams.first > 0 ) {
-                _stream.seek( fileParams.second );
-                return _stream.getRaw( fileParams.first );
+        auto it = std::lower_bound( _files.begin(), _files.end(), fileName, []( const FileEntry & entry, const std::string & name ) { return entry.name < name; } );
+        if ( it == _files.end() || it->name != fileName || it->size == 0 ) {
+            return {};
+        }
+
+        if ( _mappedData != nullptr ) {
+            if ( static_cast<size_t>( it->offset ) + it->size > _mappedSize ) {
+                return {};
             }
+
+            return { _mappedData + it->offset, it->size };
+        }
+
+        _stream.seek( it->offset );
+        return AGGFileData( _stream.getRaw( it->size ) );
+    }
+
+    void AGGFile::_mapFile( const std::string & fileName, const size_t size )
+    {
+#if defined( AGG_FILE_MEMORY_MAPPING )
+        const int fileDescriptor = ::open( fileName.c_str(), O_RDONLY );
+        if ( fileDescriptor < 0 ) {
+            return;
+        }
+
+        void * data = mmap( nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0 );
+
+        // The mapping stays valid after closing the file.
+        ::close( fileDescriptor );
+
+        if ( data == MAP_FAILED ) {
+            // The content will be read from the file stream.
+            return;
+        }
+
+        _mappedData = static_cast<const uint8_t *>( data );
+        _mappedSize = size;
+#else
+        (void)fileName;
+        (void)size;
+#endif
+    }
+
+    void AGGFile::_unmapFile()
+    {
+#if defined( AGG_FILE_MEMORY_MAPPING )
+        if ( _mappedData != nullptr ) {
+            munmap( const_cast<uint8_t *>( _mappedData ), _mappedSize );
         }
+#endif
 
-        return std::vector<uint8_t>();
+        _mappedData = nullptr;
+        _mappedSize = 0;
     }
 }
 
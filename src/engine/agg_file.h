@@ -23,7 +23,6 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <map>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,22 +31,108 @@
 
 namespace fheroes2
 {
+    // Content of a file stored inside an AGG file. If the AGG file is memory-mapped then this is a non-owning view of the mapped memory
+    // which stays valid while the AGG file is open. Otherwise the content is read into the internal buffer.
+    class AGGFileData
+    {
+    public:
+        AGGFileData() = default;
+
+        AGGFileData( const uint8_t * data, const size_t size )
+            : _data( data )
+            , _size( size )
+        {
+            // Do nothing.
+        }
+
+        explicit AGGFileData( std::vector<uint8_t> && buffer )
+            : _buffer( std::move( buffer ) )
+            , _data( _buffer.data() )
+            , _size( _buffer.size() )
+        {
+            // Do nothing.
+        }
+
+        AGGFileData( const AGGFileData & ) = delete;
+        AGGFileData( AGGFileData && ) noexcept = default;
+
+        ~AGGFileData() = default;
+
+        AGGFileData & operator=( const AGGFileData & ) = delete;
+        AGGFileData & operator=( AGGFileData && ) noexcept = default;
+
+        const uint8_t * data() const
+        {
+            return _data;
+        }
+
+        size_t size() const
+        {
+            return _size;
+        }
+
+        bool empty() const
+        {
+            return _size == 0;
+        }
+
+        const uint8_t * begin() const
+        {
+            return _data;
+        }
+
+        const uint8_t * end() const
+        {
+            return _data + _size;
+        }
+
+    private:
+        // Moving a vector keeps its buffer so _data remains valid.
+        std::vector<uint8_t> _buffer;
+
+        const uint8_t * _data{ nullptr };
+        size_t _size{ 0 };
+    };
+
     class AGGFile
     {
     public:
+        AGGFile() = default;
+        AGGFile( const AGGFile & ) = delete;
+
+        ~AGGFile();
+
+        AGGFile & operator=( const AGGFile & ) = delete;
+
         bool isGood() const
         {
             return !_stream.fail() && !_files.empty();
         }
 
         bool open( const std::string & fileName );
-        std::vector<uint8_t> read( const std::string & fileName );
+        AGGFileData read( const std::string & fileName );
 
     private:
         static const size_t _maxFilenameSize = 15; // 8.3 ASCIIZ file name + 2-bytes padding
 
+        struct FileEntry
+        {
+            std::string name;
+            uint32_t size{ 0 };
+            uint32_t offset{ 0 };
+        };
+
         StreamFile _stream;
-        std::map<std::string, std::pair<uint32_t, uint32_t>> _files;
+
+        // Sorted by file name.
+        std::vector<FileEntry> _files;
+
+        // The whole AGG file if it has been mapped into memory.
+        const uint8_t * _mappedData{ nullptr };
+        size_t _mappedSize{ 0 };
+
+        void _mapFile( const std::string & fileName, const size_t size );
+        void _unmapFile();
     };
 
     struct ICNHeader
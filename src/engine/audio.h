@@ -24,6 +24,7 @@
 #ifndef H2AUDIO_H
 #define H2AUDIO_H
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -105,7 +106,7 @@ namespace Music
 
     void SetMidiSoundFonts( const ListFiles & files );
 
-    std::vector<uint8_t> Xmi2Mid( const std::vector<uint8_t> & buf );
+    std::vector<uint8_t> Xmi2Mid( const uint8_t * data, const size_t size );
 }
 
 #endif
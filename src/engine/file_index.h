@@ -0,0 +1,136 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+
+#include "logging.h"
+#include "serialize.h"
+#include "system.h"
+
+namespace fheroes2
+{
+    // An index stores information extracted from files along with sizes and modification times of these files,
+    // so the information has to be extracted again only from new or modified files.
+    template <typename Payload>
+    struct FileIndexEntry
+    {
+        uint64_t fileSize{ 0 };
+        int64_t modificationTime{ 0 };
+        // False if no information could be extracted from the file. The payload is not stored in this case.
+        bool isValid{ false };
+        Payload payload;
+    };
+
+    // Entries are stored by file paths.
+    template <typename Payload>
+    using FileIndex = std::map<std::string, FileIndexEntry<Payload>>;
+
+    template <typename Payload>
+    StreamBase & operator<<( StreamBase & msg, const FileIndexEntry<Payload> & entry )
+    {
+        const uint64_t modificationTime = static_cast<uint64_t>( entry.modificationTime );
+
+        msg << static_cast<uint32_t>( entry.fileSize >> 32 ) << static_cast<uint32_t>( entry.fileSize ) << static_cast<uint32_t>( modificationTime >> 32 )
+            << static_cast<uint32_t>( modificationTime ) << entry.isValid;
+
+        if ( entry.isValid ) {
+            msg << entry.payload;
+        }
+
+        return msg;
+    }
+
+    template <typename Payload>
+    StreamBase & operator>>( StreamBase & msg, FileIndexEntry<Payload> & entry )
+    {
+        uint32_t fileSizeHigh = 0;
+        uint32_t fileSizeLow = 0;
+        uint32_t modificationTimeHigh = 0;
+        uint32_t modificationTimeLow = 0;
+
+        msg >> fileSizeHigh >> fileSizeLow >> modificationTimeHigh >> modificationTimeLow >> entry.isValid;
+
+        entry.fileSize = ( static_cast<uint64_t>( fileSizeHigh ) << 32 ) | fileSizeLow;
+        entry.modificationTime = static_cast<int64_t>( ( static_cast<uint64_t>( modificationTimeHigh ) << 32 ) | modificationTimeLow );
+
+        if ( entry.isValid ) {
+            msg >> entry.payload;
+        }
+
+        return msg;
+    }
+
+    // Returns an empty index if the index file does not exist, it is corrupted or it has been written with another magic number,
+    // index version or payload version. The payload version must be changed every time when the payload serialization is changed.
+    template <typename Payload>
+    FileIndex<Payload> loadFileIndex( const std::string & indexPath, const uint32_t indexMagic, const uint16_t indexVersion, const uint16_t payloadVersion )
+    {
+        if ( !System::IsFile( indexPath ) ) {
+            return {};
+        }
+
+        StreamFile fs;
+        if ( !fs.open( indexPath, "rb" ) ) {
+            return {};
+        }
+
+        fs.setbigendian( true );
+
+        uint32_t magic = 0;
+        uint16_t storedIndexVersion = 0;
+        uint16_t storedPayloadVersion = 0;
+
+        fs >> magic >> storedIndexVersion >> storedPayloadVersion;
+
+        if ( magic != indexMagic || storedIndexVersion != indexVersion || storedPayloadVersion != payloadVersion ) {
+            DEBUG_LOG( DBG_ENGINE, DBG_INFO, "File index " << indexPath << " is outdated" )
+            return {};
+        }
+
+        FileIndex<Payload> index;
+        fs >> index >> magic;
+
+        if ( fs.fail() || magic != indexMagic ) {
+            DEBUG_LOG( DBG_ENGINE, DBG_WARN, "File index " << indexPath << " is corrupted" )
+            return {};
+        }
+
+        return index;
+    }
+
+    template <typename Payload>
+    void saveFileIndex( const std::string & indexPath, const uint32_t indexMagic, const uint16_t indexVersion, const uint16_t payloadVersion,
+                        const FileIndex<Payload> & index )
+    {
+        StreamFile fs;
+        if ( !fs.open( indexPath, "wb" ) ) {
+            return;
+        }
+
+        fs.setbigendian( true );
+
+        fs << indexMagic << indexVersion << payloadVersion << index << indexMagic;
+    }
+}
@@ -394,6 +394,85 @@ namespace
         return rgbToId[red + green * 64 + blue * 64 * 64];
     }
 
+    // Returns the number of consecutive bytes equal to the given value, starting from the given position and going either forward or backward,
+    // but not more than 'maxLength'. The transform layer of the most images consists of long runs of the same value, so bytes are compared
+    // 8 at a time where possible.
+    int32_t getRunLength( const uint8_t * data, const int32_t maxLength, const uint8_t value, const bool backward )
+    {
+        const uint64_t pattern = 0x0101010101010101ULL * value;
+
+        int32_t length = 0;
+
+        for ( ; length + 8 <= maxLength; length += 8 ) {
+            uint64_t block;
+            memcpy( &block, backward ? data - length - 7 : data + length, sizeof( block ) );
+
+            if ( block != pattern ) {
+                break;
+            }
+        }
+
+        if ( backward ) {
+            while ( length < maxLength && *( data - length ) == value ) {
+                ++length;
+            }
+        }
+        else {
+            while ( length < maxLength && *( data + length ) == value ) {
+                ++length;
+            }
+        }
+
+        return length;
+    }
+
+    // Blits one row of a two-layer image. If 'flip' is true, then the input row is read from right to left starting from the given position.
+    // 'transformOut' should be nullptr if the output image is single-layer.
+    void BlitRow( const uint8_t * imageIn, const uint8_t * transformIn, uint8_t * imageOut, uint8_t * transformOut, int32_t width, const bool flip )
+    {
+        const ptrdiff_t inStep = flip ? -1 : 1;
+
+        while ( width > 0 ) {
+            const uint8_t transformValue = *transformIn;
+
+            int32_t length = 1;
+
+            if ( transformValue == 0 ) { // copy pixels
+                length = getRunLength( transformIn, width, 0, flip );
+
+                if ( flip ) {
+                    std::reverse_copy( imageIn - length + 1, imageIn + 1, imageOut );
+                }
+                else {
+                    memcpy( imageOut, imageIn, static_cast<size_t>( length ) );
+                }
+
+                if ( transformOut != nullptr ) {
+                    memset( transformOut, 0, static_cast<size_t>( length ) );
+                }
+            }
+            else if ( transformValue == 1 ) { // skip pixels
+                length = getRunLength( transformIn, width, 1, flip );
+            }
+            else if ( transformOut == nullptr || *transformOut == 0 ) { // apply a transformation
+                *imageOut = *( transformTable + static_cast<ptrdiff_t>( transformValue ) * 256 + *imageOut );
+            }
+            else { // copy a pixel
+                *transformOut = transformValue;
+                *imageOut = *imageIn;
+            }
+
+            imageIn += inStep * length;
+            transformIn += inStep * length;
+            imageOut += length;
+            if ( transformOut != nullptr ) {
+                transformOut += length;
+            }
+
+            width -= length;
+        }
+    }
+
     void ApplyRawPalette( const fheroes2::Image & in, int32_t inX, int32_t inY, fheroes2::Image & out, int32_t outX, int32_t outY, int32_t width, int32_t height,
                           const uint8_t * palette )
     {
@@ -429,10 +508,23 @@ namespace
                 uint8_t * imageOutX = imageOutY;
                 const uint8_t * imageInXEnd = imageInX + width;
 
-                for ( ; imageInX != imageInXEnd; ++imageInX, ++imageOutX, ++transformInX ) {
-                    if ( *transformInX == 0 ) { // only modify pixels with data
-                        *imageOutX = palette[*imageInX];
+                while ( imageInX != imageInXEnd ) {
+                    const uint8_t transformValue = *transformInX;
+                    const int32_t length = getRunLength( transformInX, static_cast<int32_t>( imageInXEnd - imageInX ), transformValue, false );
+
+                    if ( transformValue == 0 ) { // only modify pixels with data
+                        const uint8_t * imageInXRunEnd = imageInX + length;
+
+                        for ( uint8_t * imageOutXRun = imageOutX; imageInX != imageInXRunEnd; ++imageInX, ++imageOutXRun ) {
+                            *imageOutXRun = palette[*imageInX];
+                        }
                     }
+                    else {
+                        imageInX += length;
+                    }
+
+                    transformInX += length;
+                    imageOutX += length;
                 }
             }
         }
@@ -935,7 +1027,11 @@ namespace fheroes2
                     const uint8_t * imageOutXEnd = imageOutX + width;
 
                     for ( ; imageOutX != imageOutXEnd; --imageInX, --transformInX, ++imageOutX ) {
-                        if ( *transformInX == 1 ) { // skip pixel
+                        if ( *transformInX == 1 ) { // skip pixels
+                            const int32_t length = getRunLength( transformInX, static_cast<int32_t>( imageOutXEnd - imageOutX ), 1, true ) - 1;
+                            imageInX -= length;
+                            transformInX -= length;
+                            imageOutX += length;
                             continue;
                         }
 
@@ -989,7 +1085,11 @@ namespace fheroes2
                     const uint8_t * imageInXEnd = imageInX + width;
 
                     for ( ; imageInX != imageInXEnd; ++imageInX, ++transformInX, ++imageOutX ) {
-                        if ( *transformInX == 1 ) { // skip pixel
+                        if ( *transformInX == 1 ) { // skip pixels
+                            const int32_t length = getRunLength( transformInX, static_cast<int32_t>( imageInXEnd - imageInX ), 1, false ) - 1;
+                            imageInX += length;
+                            transformInX += length;
+                            imageOutX += length;
                             continue;
                         }
 
@@ -1106,15 +1206,29 @@ namespace fheroes2
         else {
             const uint8_t * transformY = image.transform() + y * imageWidth + x;
 
+            const uint8_t * transformTableById = transformTable + transformId * 256;
+
             for ( ; imageY != imageYEnd; imageY += imageWidth, transformY += imageWidth ) {
                 uint8_t * imageX = imageY;
                 const uint8_t * transformX = transformY;
                 const uint8_t * imageXEnd = imageX + width;
 
-                for ( ; imageX != imageXEnd; ++imageX, ++transformX ) {
-                    if ( *transformX == 0 ) {
-                        *imageX = *( transformTable + transformId * 256 + *imageX );
+                while ( imageX != imageXEnd ) {
+                    const uint8_t transformValue = *transformX;
+                    const int32_t length = getRunLength( transformX, static_cast<int32_t>( imageXEnd - imageX ), transformValue, false );
+
+                    if ( transformValue == 0 ) {
+                        const uint8_t * imageXRunEnd = imageX + length;
+
+                        for ( ; imageX != imageXRunEnd; ++imageX ) {
+                            *imageX = transformTableById[*imageX];
+                        }
+                    }
+                    else {
+                        imageX += length;
                     }
+
+                    transformX += length;
                 }
             }
         }
@@ -1144,114 +1258,26 @@ namespace fheroes2
         const int32_t widthIn = in.width();
         const int32_t widthOut = out.width();
 
-        if ( flip ) {
-            const int32_t offsetInY = inY * widthIn + widthIn - 1 - inX;
-            const uint8_t * imageInY = in.image() + offsetInY;
-            const uint8_t * transformInY = in.transform() + offsetInY;
-
-            const int32_t offsetOutY = outY * widthOut + outX;
-            uint8_t * imageOutY = out.image() + offsetOutY;
-            const uint8_t * imageOutYEnd = imageOutY + height * widthOut;
-
-            if ( out.singleLayer() ) {
-                assert( !in.singleLayer() );
-                for ( ; imageOutY != imageOutYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut ) {
-                    const uint8_t * imageInX = imageInY;
-                    const uint8_t * transformInX = transformInY;
-                    uint8_t * imageOutX = imageOutY;
-                    const uint8_t * imageOutXEnd = imageOutX + width;
-
-                    for ( ; imageOutX != imageOutXEnd; --imageInX, --transformInX, ++imageOutX ) {
-                        if ( *transformInX > 0 ) { // apply a transformation
-                            if ( *transformInX != 1 ) { // skip pixel
-                                *imageOutX = *( transformTable + ( *transformInX ) * 256 + *imageOutX );
-                            }
-                        }
-                        else { // copy a pixel
-                            *imageOutX = *imageInX;
-                        }
-                    }
-                }
-            }
-            else {
-                uint8_t * transformOutY = out.transform() + offsetOutY;
+        const int32_t offsetInY = flip ? inY * widthIn + widthIn - 1 - inX : inY * widthIn + inX;
+        const uint8_t * imageInY = in.image() + offsetInY;
+        const uint8_t * transformInY = in.transform() + offsetInY;
 
-                for ( ; imageOutY != imageOutYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut, transformOutY += widthOut ) {
-                    const uint8_t * imageInX = imageInY;
-                    const uint8_t * transformInX = transformInY;
-                    uint8_t * imageOutX = imageOutY;
-                    uint8_t * transformOutX = transformOutY;
-                    const uint8_t * imageOutXEnd = imageOutX + width;
+        const int32_t offsetOutY = outY * widthOut + outX;
+        uint8_t * imageOutY = out.image() + offsetOutY;
+        const uint8_t * imageOutYEnd = imageOutY + height * widthOut;
 
-                    for ( ; imageOutX != imageOutXEnd; --imageInX, --transformInX, ++imageOutX, ++transformOutX ) {
-                        if ( *transformInX == 1 ) { // skip pixel
-                            continue;
-                        }
+        if ( out.singleLayer() ) {
+            assert( !in.singleLayer() );
 
-                        if ( *transformInX > 0 && *transformOutX == 0 ) { // apply a transformation
-                            *imageOutX = *( transformTable + ( *transformInX ) * 256 + *imageOutX );
-                        }
-                        else { // copy a pixel
-                            *transformOutX = *transformInX;
-                            *imageOutX = *imageInX;
-                        }
-                    }
-                }
+            for ( ; imageOutY != imageOutYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut ) {
+                BlitRow( imageInY, transformInY, imageOutY, nullptr, width, flip );
             }
         }
         else {
-            const int32_t offsetInY = inY * widthIn + inX;
-            const uint8_t * imageInY = in.image() + offsetInY;
-            const uint8_t * transformInY = in.transform() + offsetInY;
-
-            const int32_t offsetOutY = outY * widthOut + outX;
-            uint8_t * imageOutY = out.image() + offsetOutY;
-            const uint8_t * imageInYEnd = imageInY + height * widthIn;
-
-            if ( out.singleLayer() ) {
-                assert( !in.singleLayer() );
-                for ( ; imageInY != imageInYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut ) {
-                    const uint8_t * imageInX = imageInY;
-                    const uint8_t * transformInX = transformInY;
-                    uint8_t * imageOutX = imageOutY;
-                    const uint8_t * imageInXEnd = imageInX + width;
-
-                    for ( ; imageInX != imageInXEnd; ++imageInX, ++transformInX, ++imageOutX ) {
-                        if ( *transformInX > 0 ) { // apply a transformation
-                            if ( *transformInX != 1 ) { // skip pixel
-                                *imageOutX = *( transformTable + ( *transformInX ) * 256 + *imageOutX );
-                            }
-                        }
-                        else { // copy a pixel
-                            *imageOutX = *imageInX;
-                        }
-                    }
-                }
-            }
-            else {
-                uint8_t * transformOutY = out.transform() + offsetOutY;
-
-                for ( ; imageInY != imageInYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut, transformOutY += widthOut ) {
-                    const uint8_t * imageInX = imageInY;
-                    const uint8_t * transformInX = transformInY;
-                    uint8_t * imageOutX = imageOutY;
-                    uint8_t * transformOutX = transformOutY;
-                    const uint8_t * imageInXEnd = imageInX + width;
-
-                    for ( ; imageInX != imageInXEnd; ++imageInX, ++transformInX, ++imageOutX, ++transformOutX ) {
-                        if ( *transformInX == 1 ) { // skip pixel
-                            continue;
-                        }
+            uint8_t * transformOutY = out.transform() + offsetOutY;
 
-                        if ( *transformInX > 0 && *transformOutX == 0 ) { // apply a transformation
-                            *imageOutX = *( transformTable + ( *transformInX ) * 256 + *imageOutX );
-                        }
-                        else { // copy a pixel
-                            *transformOutX = *transformInX;
-                            *imageOutX = *imageInX;
-                        }
-                    }
-                }
+            for ( ; imageOutY != imageOutYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut, transformOutY += widthOut ) {
+                BlitRow( imageInY, transformInY, imageOutY, transformOutY, width, flip );
             }
         }
     }
@@ -23,9 +23,11 @@
 
 #include "localevent.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
+#include <limits>
 #include <map>
 #include <set>
 #include <utility>
@@ -719,6 +721,10 @@ bool LocalEvent::HandleEvents( const bool sleepAfterEventProcessing, const bool
     // We want to make sure that we do not slow down by going into sleep mode when it is not needed.
     const fheroes2::Time eventProcessingTimer;
 
+    // The wait time is provided only for the current call so it must not be left for any later call whatever way this function exits.
+    const fheroes2::TimeDelay idleWaitDelay = _idleWaitDelay;
+    _idleWaitDelay.setDelay( 0 );
+
     // We can have more than one event which requires rendering. We must render only once and only when sleeping is excepted.
     fheroes2::Rect renderRoi;
 
@@ -855,8 +861,19 @@ bool LocalEvent::HandleEvents( const bool sleepAfterEventProcessing, const bool
             display.render( renderRoi );
         }
 
-        // Make sure not to delay any further if the processing time within this function was more than the expected waiting time.
-        if ( eventProcessingTimer.getMs() < globalLoopSleepTime ) {
+        const uint64_t idleWaitTime = std::min( idleWaitDelay.getRemainingMs(), fheroes2::RenderProcessor::instance().getTimeToCyclingUpdate() );
+
+        // Pressed buttons and controller sticks are processed by polling so we cannot wait for new events while they are active.
+        const bool isPollingRequired = ( modes & ( MOUSE_PRESSED | KEY_HOLD ) )
+                                       || ( _gameController != nullptr && ( _controllerLeftXAxis != 0 || _controllerLeftYAxis != 0 || _controllerScrollActive ) );
+
+        if ( idleWaitTime > globalLoopSleepTime && !isPollingRequired ) {
+            // Nothing is going to be changed on the screen until a new event comes or the next frame has to be rendered.
+            // Events are not removed from the queue here: they are going to be processed by the next call of this function.
+            SDL_WaitEventTimeout( nullptr, static_cast<int>( std::min<uint64_t>( idleWaitTime, std::numeric_limits<int>::max() ) ) );
+        }
+        else if ( eventProcessingTimer.getMs() < globalLoopSleepTime ) {
+            // Make sure not to delay any further if the processing time within this function was more than the expected waiting time.
             static_assert( globalLoopSleepTime == 1, "Make sure that you sleep for the difference between times since you change the sleep time." );
             SDL_Delay( globalLoopSleepTime );
         }
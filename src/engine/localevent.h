@@ -195,6 +195,14 @@ public:
 
     bool HandleEvents( const bool sleepAfterEventProcessing = true, const bool allowExit = false );
 
+    // Allows the next call of HandleEvents() to wait for new events for up to the given time instead of a minimal sleep
+    // if nothing has to be updated before that. Call it right before HandleEvents() with the time until the next animation frame.
+    void setIdleWaitTime( const uint64_t waitMs )
+    {
+        _idleWaitDelay.setDelay( waitMs );
+        _idleWaitDelay.reset();
+    }
+
     bool MouseMotion() const
     {
         return ( modes & MOUSE_MOTION ) == MOUSE_MOTION;
@@ -402,6 +410,9 @@ private:
 
     LongPressDelay _mouseButtonLongPressDelay;
 
+    // The time until the next frame must be rendered by the caller of HandleEvents(). It is valid only for one call and is reset by it.
+    fheroes2::TimeDelay _idleWaitDelay{ 0 };
+
     std::function<fheroes2::Rect( const int32_t, const int32_t )> _globalMouseMotionEventHook;
     std::function<void( const fheroes2::Key, const int32_t )> _globalKeyDownEventHook;
 
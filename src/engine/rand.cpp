@@ -65,6 +65,27 @@ uint32_t Rand::GetWithGen( uint32_t from, uint32_t to, std::mt19937 & gen )
     return distrib( gen );
 }
 
+uint32_t Rand::SplitMix64::get( uint32_t from, uint32_t to )
+{
+    if ( from > to )
+        std::swap( from, to );
+
+    const uint64_t range = static_cast<uint64_t>( to - from ) + 1;
+
+    // Lemire's multiply-shift method: the upper 32 bits of the product are the result and the values which would make it biased are rejected.
+    uint64_t product = ( ( *this )() >> 32 ) * range;
+
+    if ( static_cast<uint32_t>( product ) < range ) {
+        const uint32_t threshold = static_cast<uint32_t>( ( ( UINT64_C( 1 ) << 32 ) - range ) % range );
+
+        while ( static_cast<uint32_t>( product ) < threshold ) {
+            product = ( ( *this )() >> 32 ) * range;
+        }
+    }
+
+    return from + static_cast<uint32_t>( product >> 32 );
+}
+
 Rand::Queue::Queue( uint32_t size )
 {
     reserve( size );
@@ -128,8 +149,9 @@ int32_t Rand::Queue::GetWithSeed( uint32_t seed )
     return Rand::Queue::Get( [seed]( uint32_t max ) { return Rand::GetWithSeed( 0, max, seed ); } );
 }
 
-Rand::DeterministicRandomGenerator::DeterministicRandomGenerator( const uint32_t initialSeed )
+Rand::DeterministicRandomGenerator::DeterministicRandomGenerator( const uint32_t initialSeed, const Algorithm algorithm /*= Algorithm::SPLITMIX64*/ )
     : _currentSeed( initialSeed )
+    , _algorithm( algorithm )
 {}
 
 uint32_t Rand::DeterministicRandomGenerator::GetSeed() const
@@ -145,5 +167,10 @@ void Rand::DeterministicRandomGenerator::UpdateSeed( const uint32_t seed )
 uint32_t Rand::DeterministicRandomGenerator::Get( const uint32_t from, const uint32_t to /*= 0*/ ) const
 {
     ++_currentSeed;
-    return Rand::GetWithSeed( from, to, _currentSeed );
+
+    if ( _algorithm == Algorithm::MT19937 ) {
+        return Rand::GetWithSeed( from, to, _currentSeed );
+    }
+
+    return SplitMix64( _currentSeed ).get( from, to );
 }
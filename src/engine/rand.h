@@ -97,6 +97,46 @@ namespace Rand
         return *it;
     }
 
+    // Counter-based pseudo random number generator (SplitMix64). Unlike std::mt19937 with its 2.5 KB state it is almost free to create
+    // so a new generator can be made for every random value. The produced values do not depend on the standard library implementation.
+    class SplitMix64
+    {
+    public:
+        explicit SplitMix64( const uint64_t seed )
+            : _state( seed )
+        {
+            // Do nothing.
+        }
+
+        uint64_t operator()()
+        {
+            _state += 0x9E3779B97F4A7C15;
+
+            uint64_t value = _state;
+            value = ( value ^ ( value >> 30 ) ) * 0xBF58476D1CE4E5B9;
+            value = ( value ^ ( value >> 27 ) ) * 0x94D049BB133111EB;
+
+            return value ^ ( value >> 31 );
+        }
+
+        // Returns an unbiased random value within [from, to] range. The values can be given in any order.
+        uint32_t get( uint32_t from, uint32_t to );
+
+        template <typename T>
+        void shuffle( std::vector<T> & vec )
+        {
+            for ( size_t i = vec.size(); i > 1; --i ) {
+                const uint32_t id = get( 0, static_cast<uint32_t>( i - 1 ) );
+                if ( id != i - 1 ) {
+                    std::swap( vec[i - 1], vec[id] );
+                }
+            }
+        }
+
+    private:
+        uint64_t _state;
+    };
+
     using ValuePercent = std::pair<int32_t, uint32_t>;
 
     class Queue : private std::vector<ValuePercent>
@@ -117,7 +157,16 @@ namespace Rand
     class DeterministicRandomGenerator
     {
     public:
-        explicit DeterministicRandomGenerator( const uint32_t initialSeed );
+        // Every random value is generated by a new generator seeded by the incremented current seed.
+        // The algorithm must be kept for the whole game to make the results reproducible.
+        enum class Algorithm : uint8_t
+        {
+            // Used by the games saved before FORMAT_VERSION_PRE1_1010_RELEASE.
+            MT19937 = 0,
+            SPLITMIX64 = 1
+        };
+
+        explicit DeterministicRandomGenerator( const uint32_t initialSeed, const Algorithm algorithm = Algorithm::SPLITMIX64 );
 
         // prevent accidental copies
         DeterministicRandomGenerator( const DeterministicRandomGenerator & ) = delete;
@@ -131,20 +180,34 @@ namespace Rand
         template <typename T>
         const T & Get( const std::vector<T> & vec ) const
         {
+            assert( !vec.empty() );
+
             ++_currentSeed;
-            std::mt19937 seededGen( _currentSeed );
-            return Rand::GetWithGen( vec, seededGen );
+
+            if ( _algorithm == Algorithm::MT19937 ) {
+                std::mt19937 seededGen( _currentSeed );
+                return Rand::GetWithGen( vec, seededGen );
+            }
+
+            return vec[SplitMix64( _currentSeed ).get( 0, static_cast<uint32_t>( vec.size() - 1 ) )];
         }
 
         template <class T>
         void Shuffle( std::vector<T> & vector ) const
         {
             ++_currentSeed;
-            Rand::ShuffleWithSeed( vector, _currentSeed );
+
+            if ( _algorithm == Algorithm::MT19937 ) {
+                Rand::ShuffleWithSeed( vector, _currentSeed );
+                return;
+            }
+
+            SplitMix64( _currentSeed ).shuffle( vector );
         }
 
     private:
         mutable uint32_t _currentSeed; // this is mutable so clients that only call RNG method can receive a const instance
+        const Algorithm _algorithm;
     };
 }
 
@@ -21,6 +21,7 @@
 #include "render_processor.h"
 
 #include <cstdint>
+#include <limits>
 
 #include "pal.h"
 
@@ -61,6 +62,16 @@ namespace fheroes2
         return true;
     }
 
+    uint64_t RenderProcessor::getTimeToCyclingUpdate() const
+    {
+        if ( !_enableCycling ) {
+            return std::numeric_limits<uint64_t>::max();
+        }
+
+        const uint64_t passedMs = _lastRenderCall.getMs();
+        return passedMs >= _cyclingInterval ? 0 : _cyclingInterval - passedMs;
+    }
+
     void RenderProcessor::postRenderAction()
     {
         _lastRenderCall.reset();
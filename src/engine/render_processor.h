@@ -79,6 +79,10 @@ namespace fheroes2
             return _enableCycling && _lastRenderCall.getMs() >= _cyclingInterval;
         }
 
+        // Returns the time in milliseconds left until the next color cycling frame must be rendered.
+        // If color cycling is disabled nothing has to be rendered so the maximum possible value is returned.
+        uint64_t getTimeToCyclingUpdate() const;
+
     private:
         RenderProcessor() = default;
 
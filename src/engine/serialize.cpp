@@ -34,6 +34,9 @@
 namespace
 {
     const size_t minBufferCapacity = 1024;
+
+    // Most of the files are read by small fields of 1 - 4 bytes so they are read from the disk by big chunks.
+    const size_t readAheadBufferSize = 64 * 1024;
 }
 
 void StreamBase::setconstbuf( bool f )
@@ -312,7 +315,8 @@ void StreamBuf::reallocbuf( size_t size )
             size = minBufferCapacity;
         }
 
-        itbeg = new uint8_t[size]{};
+        // There is no need to initialize the memory: the data is always written before being read.
+        itbeg = new uint8_t[size];
         itend = itbeg + size;
 
         reset();
@@ -322,7 +326,7 @@ void StreamBuf::reallocbuf( size_t size )
             size = minBufferCapacity;
         }
 
-        uint8_t * ptr = new uint8_t[size]{};
+        uint8_t * ptr = new uint8_t[size];
 
         std::copy( itbeg, itput, ptr );
 
@@ -336,10 +340,23 @@ void StreamBuf::reallocbuf( size_t size )
     }
 }
 
+void StreamBuf::reserve( const size_t size )
+{
+    if ( sizep() < size ) {
+        reallocbuf( tellp() + size );
+    }
+}
+
+void StreamBuf::grow( const size_t size )
+{
+    // Grow geometrically so that writing of a large amount of data byte by byte takes linear time.
+    reallocbuf( std::max( capacity() * 2, tellp() + size ) );
+}
+
 void StreamBuf::put8( const uint8_t v )
 {
     if ( sizep() < 1 ) {
-        reallocbuf( capacity() + capacity() / 2 );
+        grow( 1 );
     }
 
     if ( sizep() < 1 ) {
@@ -444,12 +461,7 @@ void StreamBuf::putRaw( const char * ptr, size_t sz )
     }
 
     if ( sizep() < sz ) {
-        if ( sz < capacity() / 2 ) {
-            reallocbuf( capacity() + capacity() / 2 );
-        }
-        else {
-            reallocbuf( capacity() + sz );
-        }
+        grow( sz );
     }
 
     if ( sizep() < sz ) {
@@ -479,6 +491,9 @@ void StreamBuf::skip( size_t sz )
 
 StreamFile::StreamFile()
     : _file( nullptr )
+    , _readBufferOffset( 0 )
+    , _readBufferPos( 0 )
+    , _readBufferEnd( 0 )
 {}
 
 StreamFile::~StreamFile()
@@ -488,6 +503,8 @@ StreamFile::~StreamFile()
 
 bool StreamFile::open( const std::string & fn, const std::string & mode )
 {
+    close();
+
     _file = std::fopen( fn.c_str(), mode.c_str() );
     if ( !_file )
         ERROR_LOG( fn )
@@ -500,6 +517,67 @@ void StreamFile::close()
         std::fclose( _file );
         _file = nullptr;
     }
+
+    _readBufferOffset = 0;
+    _readBufferPos = 0;
+    _readBufferEnd = 0;
+}
+
+bool StreamFile::readBytes( uint8_t * data, size_t size )
+{
+    if ( !_file ) {
+        return false;
+    }
+
+    const size_t bufferedSize = std::min( size, _readBufferEnd - _readBufferPos );
+    if ( bufferedSize > 0 ) {
+        memcpy( data, _readBuffer.data() + _readBufferPos, bufferedSize );
+        _readBufferPos += bufferedSize;
+        data += bufferedSize;
+        size -= bufferedSize;
+    }
+
+    if ( size == 0 ) {
+        return true;
+    }
+
+    // The buffer is exhausted at this point.
+    _readBufferOffset = 0;
+    _readBufferPos = 0;
+    _readBufferEnd = 0;
+
+    if ( size >= readAheadBufferSize ) {
+        // There is no point to copy big chunks of data through the buffer.
+        return std::fread( data, size, 1, _file ) == 1;
+    }
+
+    if ( _readBuffer.empty() ) {
+        _readBuffer.resize( readAheadBufferSize );
+    }
+
+    _readBufferOffset = tellg();
+    _readBufferEnd = std::fread( _readBuffer.data(), 1, _readBuffer.size(), _file );
+
+    if ( _readBufferEnd < size ) {
+        _readBufferPos = _readBufferEnd;
+        return false;
+    }
+
+    memcpy( data, _readBuffer.data(), size );
+    _readBufferPos = size;
+
+    return true;
+}
+
+void StreamFile::discardReadBuffer()
+{
+    if ( _readBufferPos < _readBufferEnd ) {
+        std::fseek( _file, static_cast<long>( _readBufferOffset + _readBufferPos ), SEEK_SET );
+    }
+
+    _readBufferOffset = 0;
+    _readBufferPos = 0;
+    _readBufferEnd = 0;
 }
 
 size_t StreamFile::size() const
@@ -520,8 +598,21 @@ size_t StreamFile::tell() const
 
 void StreamFile::seek( size_t pos )
 {
-    if ( _file )
-        std::fseek( _file, static_cast<long>( pos ), SEEK_SET );
+    if ( !_file ) {
+        return;
+    }
+
+    if ( _readBufferEnd > 0 && pos >= _readBufferOffset && pos <= _readBufferOffset + _readBufferEnd ) {
+        // The position is within the already read data.
+        _readBufferPos = pos - _readBufferOffset;
+        return;
+    }
+
+    _readBufferOffset = 0;
+    _readBufferPos = 0;
+    _readBufferEnd = 0;
+
+    std::fseek( _file, static_cast<long>( pos ), SEEK_SET );
 }
 
 size_t StreamFile::sizeg() const
@@ -532,12 +623,17 @@ size_t StreamFile::sizeg() const
     std::fseek( _file, 0, SEEK_END );
     const long len = std::ftell( _file );
     std::fseek( _file, pos, SEEK_SET );
-    return static_cast<size_t>( len - pos );
+    return static_cast<size_t>( len ) - tellg();
 }
 
 size_t StreamFile::tellg() const
 {
-    return _file ? static_cast<size_t>( std::ftell( _file ) ) : 0;
+    if ( !_file ) {
+        return 0;
+    }
+
+    // Take into account the data that has been read in advance but not consumed yet.
+    return static_cast<size_t>( std::ftell( _file ) ) - ( _readBufferEnd - _readBufferPos );
 }
 
 size_t StreamFile::sizep() const
@@ -552,8 +648,23 @@ size_t StreamFile::tellp() const
 
 void StreamFile::skip( size_t pos )
 {
-    if ( _file )
-        std::fseek( _file, static_cast<long int>( pos ), SEEK_CUR );
+    if ( !_file ) {
+        return;
+    }
+
+    if ( pos <= _readBufferEnd - _readBufferPos ) {
+        _readBufferPos += pos;
+        return;
+    }
+
+    // The actual file position is at the end of the buffered data.
+    pos -= _readBufferEnd - _readBufferPos;
+
+    _readBufferOffset = 0;
+    _readBufferPos = 0;
+    _readBufferEnd = 0;
+
+    std::fseek( _file, static_cast<long int>( pos ), SEEK_CUR );
 }
 
 uint8_t StreamFile::get8()
@@ -615,8 +726,7 @@ std::vector<uint8_t> StreamFile::getRaw( const size_t size )
 
     std::vector<uint8_t> v( chunkSize );
 
-    const size_t count = std::fread( &v[0], chunkSize, 1, _file );
-    if ( count != 1 ) {
+    if ( !readBytes( v.data(), chunkSize ) ) {
         setfail( true );
         return {};
     }
@@ -627,6 +737,7 @@ std::vector<uint8_t> StreamFile::getRaw( const size_t size )
 void StreamFile::putRaw( const char * ptr, size_t sz )
 {
     if ( _file ) {
+        discardReadBuffer();
         std::fwrite( ptr, sz, 1, _file );
     }
 }
@@ -640,8 +751,7 @@ StreamBuf StreamFile::toStreamBuf( const size_t size )
 
     StreamBuf buffer( chunkSize );
 
-    const size_t count = std::fread( buffer.data(), chunkSize, 1, _file );
-    if ( count != 1 ) {
+    if ( !readBytes( buffer.data(), chunkSize ) ) {
         setfail( true );
         return StreamBuf{};
     }
@@ -28,6 +28,7 @@
 #include <array>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <iterator>
 #include <list>
 #include <map>
@@ -274,9 +275,14 @@ public:
         return itend - itbeg;
     }
 
+    // Makes sure that at least 'size' more bytes can be written without reallocation of the buffer. Use it when the amount of data
+    // to be written is known (or can be estimated) in advance.
+    void reserve( const size_t size );
+
+    // The read position never goes beyond the written data, the rest of the buffer is not initialized.
     void seek( size_t sz )
     {
-        itget = itbeg + sz < itend ? itbeg + sz : itend;
+        itget = sz < static_cast<size_t>( itput - itbeg ) ? itbeg + sz : itput;
     }
 
     void skip( size_t sz ) override;
@@ -306,6 +312,9 @@ protected:
 
     void reallocbuf( size_t size );
 
+    // Reallocates the buffer to fit at least 'size' more bytes, at least doubling its capacity.
+    void grow( const size_t size );
+
     uint8_t get8() override;
     void put8( const uint8_t v ) override;
 
@@ -317,7 +326,7 @@ protected:
     uint8_t * itend;
 };
 
-class StreamFile : public StreamBase
+class StreamFile final : public StreamBase
 {
 public:
     StreamFile();
@@ -370,20 +379,41 @@ protected:
 private:
     std::FILE * _file;
 
+    // Data read from the file in advance. The actual file position is always at the end of the valid data in this buffer.
+    std::vector<uint8_t> _readBuffer;
+    // File offset of the first byte of the buffer.
+    size_t _readBufferOffset;
+    // Current read position and the end of the valid data in the buffer.
+    size_t _readBufferPos;
+    size_t _readBufferEnd;
+
+    // Reads the given number of bytes using the read-ahead buffer. Returns false if there is not enough data in the file.
+    bool readBytes( uint8_t * data, size_t size );
+
+    // Moves the actual file position to the current read position and drops the read-ahead buffer.
+    void discardReadBuffer();
+
     template <typename T>
     T getUint()
     {
-        if ( !_file )
-            return 0;
         T val;
-        return std::fread( &val, sizeof( T ), 1, _file ) == 1 ? val : 0;
+
+        if ( _readBufferEnd - _readBufferPos >= sizeof( T ) ) {
+            std::memcpy( &val, _readBuffer.data() + _readBufferPos, sizeof( T ) );
+            _readBufferPos += sizeof( T );
+            return val;
+        }
+
+        return readBytes( reinterpret_cast<uint8_t *>( &val ), sizeof( T ) ) ? val : 0;
     }
 
     template <typename T>
     void putUint( const T val )
     {
-        if ( _file )
+        if ( _file ) {
+            discardReadBuffer();
             std::fwrite( &val, sizeof( T ), 1, _file );
+        }
     }
 };
 
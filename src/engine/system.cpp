@@ -24,6 +24,7 @@
 #include "system.h"
 
 #include <cassert>
+#include <cstdint>
 #include <cstdlib>
 #include <filesystem>
 #include <initializer_list>
@@ -440,6 +441,27 @@ bool System::IsDirectory( const std::string & path, bool writable )
 #endif
 }
 
+bool System::GetFileSizeAndModificationTime( const std::string & path, uint64_t & size, int64_t & modificationTime )
+{
+    std::error_code ec;
+
+    // Using the non-throwing overloads
+    const std::uintmax_t fileSize = std::filesystem::file_size( path, ec );
+    if ( ec ) {
+        return false;
+    }
+
+    const std::filesystem::file_time_type fileTime = std::filesystem::last_write_time( path, ec );
+    if ( ec ) {
+        return false;
+    }
+
+    size = fileSize;
+    modificationTime = static_cast<int64_t>( fileTime.time_since_epoch().count() );
+
+    return true;
+}
+
 bool System::Unlink( const std::string & path )
 {
 #if defined( _WIN32 )
@@ -449,6 +471,16 @@ bool System::Unlink( const std::string & path )
 #endif
 }
 
+bool System::ReplaceFile( const std::string & sourcePath, const std::string & destinationPath )
+{
+    std::error_code ec;
+
+    // Unlike std::rename() this function replaces an existing file on all platforms, including Windows.
+    std::filesystem::rename( sourcePath, destinationPath, ec );
+
+    return !ec;
+}
+
 #if !defined( _WIN32 ) && !defined( ANDROID )
 // based on: https://github.com/OneSadCookie/fcaseopen
 bool System::GetCaseInsensitivePath( const std::string & path, std::string & correctedPath )
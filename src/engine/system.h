@@ -24,6 +24,7 @@
 #ifndef H2SYSTEM_H
 #define H2SYSTEM_H
 
+#include <cstdint>
 #include <ctime>
 #include <string>
 #include <string_view>
@@ -51,8 +52,17 @@ namespace System
 
     bool IsFile( const std::string & path, bool writable = false );
     bool IsDirectory( const std::string & path, bool writable = false );
+
+    // Returns the size and the last modification time of the given file. The modification time can only be compared with another
+    // modification time returned by this function. Returns false if the file doesn't exist or its attributes cannot be retrieved.
+    bool GetFileSizeAndModificationTime( const std::string & path, uint64_t & size, int64_t & modificationTime );
+
     bool Unlink( const std::string & path );
 
+    // Renames the source file to the destination file. If the destination file exists it is replaced atomically where the OS supports it.
+    // Returns false if the file cannot be renamed, in which case both files are left untouched.
+    bool ReplaceFile( const std::string & sourcePath, const std::string & destinationPath );
+
     bool GetCaseInsensitivePath( const std::string & path, std::string & correctedPath );
 
     // Resolves the wildcard pattern 'glob' and appends matching paths to 'fileNames'. Supported wildcards are '?' and '*'.
@@ -20,8 +20,10 @@
 
 #include "thread.h"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
+#include <vector>
 
 namespace MultiThreading
 {
@@ -98,4 +100,38 @@ namespace MultiThreading
             manager->executeTask();
         }
     }
+
+    void runParallelTasks( const size_t count, const std::function<void( const size_t )> & task )
+    {
+        const size_t threadCount = std::min<size_t>( std::max( std::thread::hardware_concurrency(), 1U ), count );
+
+        if ( threadCount <= 1 ) {
+            for ( size_t i = 0; i < count; ++i ) {
+                task( i );
+            }
+
+            return;
+        }
+
+        std::atomic<size_t> nextIndex{ 0 };
+
+        const auto processTasks = [count, &task, &nextIndex]() {
+            for ( size_t i = nextIndex++; i < count; i = nextIndex++ ) {
+                task( i );
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve( threadCount - 1 );
+
+        for ( size_t i = 1; i < threadCount; ++i ) {
+            workers.emplace_back( processTasks );
+        }
+
+        processTasks();
+
+        for ( std::thread & worker : workers ) {
+            worker.join();
+        }
+    }
 }
@@ -22,6 +22,8 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -71,4 +73,8 @@ namespace MultiThreading
 
         static void _workerThread( AsyncManager * manager );
     };
+
+    // Calls the task for every index from 0 to count - 1 on all available hardware threads, including the calling one,
+    // and returns once all the calls are done. Tasks are executed concurrently so they must not modify any shared state.
+    void runParallelTasks( const size_t count, const std::function<void( const size_t )> & task );
 }
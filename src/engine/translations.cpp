@@ -145,36 +145,23 @@ namespace
         LOCALE_UK
     };
 
+    // An entry of the open addressing hash table of translated strings. An entry with zero length is an empty one.
     struct chunk
     {
-        uint32_t offset;
-        uint32_t length;
-
-        chunk( const uint32_t off, const uint32_t len )
-            : offset( off )
-            , length( len )
-        {
-            // Do nothing.
-        }
+        uint32_t hash{ 0 };
+        uint32_t originalOffset{ 0 };
+        // The length of the singular form of the original text.
+        uint32_t originalLength{ 0 };
+        uint32_t offset{ 0 };
+        uint32_t length{ 0 };
     };
 
-    uint32_t crc32b( const char * msg )
-    {
-        uint32_t crc = 0xFFFFFFFF;
-        uint32_t index = 0;
-
-        while ( msg[index] ) {
-            crc ^= static_cast<uint32_t>( msg[index] );
-
-            for ( int bit = 0; bit < 8; ++bit ) {
-                const uint32_t poly = ( crc & 1 ) ? 0xEDB88320 : 0x0;
-                crc = ( crc >> 1 ) ^ poly;
-            }
+    // The number of entries in the cache of the latest string lookups. It must be a power of 2.
+    const size_t lookupCacheSize = 1024;
 
-            ++index;
-        }
-
-        return ~crc;
+    uint32_t getStringHash( const char * str )
+    {
+        return fheroes2::calculateCRC32( reinterpret_cast<const uint8_t *>( str ), std::strlen( str ) );
     }
 
     std::string getTag( const std::string & str, const std::string & tag, const std::string & sep )
@@ -201,26 +188,88 @@ namespace
         // TODO: plural forms are not in use: Plural-Forms.
         LocaleType locale{ LocaleType::LOCALE_EN };
         StreamBuf buf;
-        std::map<uint32_t, chunk> hash_offsets;
+        // The size of this table is always a power of 2 and it is at least twice bigger than the number of translated strings.
+        std::vector<chunk> hashTable;
+        // Most of strings are literals which are translated many times so the latest lookups are cached by the string address.
+        // The address is used only as a hint: the string is still compared to the original one as the address can be reused for another string.
+        std::array<std::pair<const char *, uint32_t>, lookupCacheSize> lookupCache{};
         std::string domain;
         std::string encoding;
 
+        bool isOriginalString( const chunk & entry, const char * str )
+        {
+            buf.seek( entry.originalOffset );
+
+            // The original text is not read beyond its length which has been validated while loading the file.
+            return std::strncmp( reinterpret_cast<const char *>( buf.data() ), str, entry.originalLength ) == 0 && str[entry.originalLength] == '\0';
+        }
+
+        // Returns true if the string of the given length fits into the file and it is null-terminated.
+        bool isValidString( const uint32_t offset, const uint32_t length, const size_t fileSize )
+        {
+            if ( static_cast<uint64_t>( offset ) + length >= fileSize ) {
+                return false;
+            }
+
+            buf.seek( static_cast<size_t>( offset ) + length );
+
+            return buf.data()[0] == 0;
+        }
+
+        const chunk * find( const char * str )
+        {
+            if ( hashTable.empty() ) {
+                return nullptr;
+            }
+
+            // Multiplicative hashing of the address: string literals are not aligned so all bits are in use.
+            const size_t cacheId = static_cast<size_t>( ( static_cast<uint64_t>( reinterpret_cast<uintptr_t>( str ) ) * 0x9E3779B97F4A7C15 ) >> 54 );
+            static_assert( ( static_cast<size_t>( 1 ) << ( 64 - 54 ) ) == lookupCacheSize, "The cache ID must be within the cache size" );
+
+            std::pair<const char *, uint32_t> & cachedLookup = lookupCache[cacheId];
+            if ( cachedLookup.first == str && isOriginalString( hashTable[cachedLookup.second], str ) ) {
+                return &hashTable[cachedLookup.second];
+            }
+
+            const uint32_t hash = getStringHash( str );
+            const size_t mask = hashTable.size() - 1;
+
+            for ( size_t id = hash & mask;; id = ( id + 1 ) & mask ) {
+                const chunk & entry = hashTable[id];
+                if ( entry.length == 0 ) {
+                    return nullptr;
+                }
+
+                if ( entry.hash == hash && isOriginalString( entry, str ) ) {
+                    cachedLookup = { str, static_cast<uint32_t>( id ) };
+                    return &entry;
+                }
+            }
+        }
+
         const char * ngettext( const char * str, size_t plural )
         {
-            std::map<uint32_t, chunk>::const_iterator it = hash_offsets.find( crc32b( str ) );
-            if ( it == hash_offsets.end() )
+            const chunk * entry = find( str );
+            if ( entry == nullptr )
                 return stripContext( str );
 
-            buf.seek( ( *it ).second.offset );
+            buf.seek( entry->offset );
             const uint8_t * ptr = buf.data();
+            const uint8_t * ptrEnd = ptr + entry->length;
 
+            // If there are fewer plural forms than requested the last one is used.
             while ( plural > 0 ) {
-                while ( *ptr ) {
-                    ++ptr;
+                const uint8_t * nextForm = ptr;
+                while ( *nextForm ) {
+                    ++nextForm;
+                }
+
+                if ( nextForm == ptrEnd ) {
+                    break;
                 }
 
                 --plural;
-                ++ptr;
+                ptr = nextForm + 1;
             }
 
             return reinterpret_cast<const char *>( ptr );
@@ -261,6 +310,14 @@ namespace
 
             sf >> stringCount >> originalOffset >> translationOffset >> hashSize >> hashOffset;
 
+            // Every string has an entry of 2 32-bit values in the table of original strings and in the table of translated strings.
+            // Both tables must fit into the file, otherwise a broken string count leads to a huge lookup table.
+            const uint64_t stringTableSize = static_cast<uint64_t>( stringCount ) * 8;
+            if ( static_cast<uint64_t>( originalOffset ) + stringTableSize > fileSize || static_cast<uint64_t>( translationOffset ) + stringTableSize > fileSize ) {
+                ERROR_LOG( "Incorrect number of strings " << stringCount << " for " << file )
+                return false;
+            }
+
             sf.seek( 0 );
             buf = sf.toStreamBuf( fileSize );
             sf.close();
@@ -284,6 +341,17 @@ namespace
 
             uint32_t totalTranslationStrings = stringCount;
 
+            size_t hashTableSize = 1;
+            while ( hashTableSize < static_cast<size_t>( stringCount ) * 2 ) {
+                hashTableSize *= 2;
+            }
+
+            hashTable.clear();
+            hashTable.resize( hashTableSize );
+            lookupCache.fill( { nullptr, 0 } );
+
+            const size_t mask = hashTableSize - 1;
+
             for ( uint32_t index = 0; index < stringCount; ++index ) {
                 buf.seek( originalOffset + index * 8 );
 
@@ -295,10 +363,15 @@ namespace
                 }
 
                 const uint32_t offset1 = buf.get32();
+                if ( !isValidString( offset1, length1, fileSize ) ) {
+                    ERROR_LOG( "Invalid original text " << index << " in " << file )
+                    --totalTranslationStrings;
+                    continue;
+                }
+
                 buf.seek( offset1 );
                 const std::string msg1 = buf.toString( length1 );
 
-                const uint32_t crc = crc32b( msg1.data() );
                 buf.seek( translationOffset + index * 8 );
 
                 const uint32_t length2 = buf.get32();
@@ -309,11 +382,32 @@ namespace
                 }
 
                 const uint32_t offset2 = buf.get32();
+                if ( !isValidString( offset2, length2, fileSize ) ) {
+                    ERROR_LOG( "Invalid translation " << index << " in " << file )
+                    --totalTranslationStrings;
+                    continue;
+                }
 
-                const auto [dummy, inserted] = hash_offsets.try_emplace( crc, chunk{ offset2, length2 } );
-                if ( !inserted ) {
-                    ERROR_LOG( "Clashing hash value for: " << msg1 )
+                // Only the singular form of the original text is used for search.
+                const uint32_t hash = getStringHash( msg1.c_str() );
+                const uint32_t singularLength = static_cast<uint32_t>( std::strlen( msg1.c_str() ) );
+
+                size_t id = hash & mask;
+                bool isDuplicate = false;
+
+                for ( ; hashTable[id].length != 0; id = ( id + 1 ) & mask ) {
+                    if ( hashTable[id].hash == hash && hashTable[id].originalLength == singularLength && isOriginalString( hashTable[id], msg1.c_str() ) ) {
+                        isDuplicate = true;
+                        break;
+                    }
                 }
+
+                if ( isDuplicate ) {
+                    ERROR_LOG( "Duplicate original text: " << msg1 )
+                    continue;
+                }
+
+                hashTable[id] = { hash, offset1, singularLength, offset2, length2 };
             }
 
             return ( totalTranslationStrings > 0 );
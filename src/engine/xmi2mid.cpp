@@ -260,10 +260,10 @@ struct XMIData
 {
     XMITracks tracks;
 
-    explicit XMIData( const std::vector<uint8_t> & buf )
+    XMIData( const uint8_t * data, const size_t size )
     {
         // Please refer to https://moddingwiki.shikadi.net/wiki/XMI_Format#File_format
-        StreamBuf sb( buf );
+        StreamBuf sb( data, size );
 
         GroupChunkHeader group;
         sb >> group;
@@ -676,9 +676,9 @@ StreamBuf & operator<<( StreamBuf & sb, const MidData & st )
     return sb;
 }
 
-std::vector<uint8_t> Music::Xmi2Mid( const std::vector<uint8_t> & buf )
+std::vector<uint8_t> Music::Xmi2Mid( const uint8_t * data, const size_t size )
 {
-    XMIData xmi( buf );
+    XMIData xmi( data, size );
     StreamBuf sb( 16 * 4096 );
 
     if ( xmi.isvalid() ) {
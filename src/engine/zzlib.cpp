@@ -24,7 +24,10 @@
 #include "zzlib.h"
 
 #include <algorithm>
+#include <array>
+#include <cassert>
 #include <cstring>
+#include <limits>
 #include <ostream>
 #include <vector>
 
@@ -37,6 +40,29 @@ namespace
 {
     constexpr uint16_t FORMAT_VERSION_0 = 0;
 
+    // Size of the header of a zipped chunk: raw size, zip size, format version and 2 unused bytes.
+    constexpr size_t CHUNK_HEADER_SIZE = 12;
+
+    // Sizes of the buffers used by ZStreamFile to pass the data to the compressor and to receive the compressed data.
+    constexpr size_t STREAM_INPUT_BUFFER_SIZE = 256 * 1024;
+    constexpr size_t STREAM_OUTPUT_BUFFER_SIZE = 64 * 1024;
+
+    std::array<uint8_t, CHUNK_HEADER_SIZE> getChunkHeader( const uint32_t rawSize, const uint32_t zipSize )
+    {
+        return { static_cast<uint8_t>( rawSize >> 24 ),
+                 static_cast<uint8_t>( ( rawSize >> 16 ) & 0xFF ),
+                 static_cast<uint8_t>( ( rawSize >> 8 ) & 0xFF ),
+                 static_cast<uint8_t>( rawSize & 0xFF ),
+                 static_cast<uint8_t>( zipSize >> 24 ),
+                 static_cast<uint8_t>( ( zipSize >> 16 ) & 0xFF ),
+                 static_cast<uint8_t>( ( zipSize >> 8 ) & 0xFF ),
+                 static_cast<uint8_t>( zipSize & 0xFF ),
+                 static_cast<uint8_t>( FORMAT_VERSION_0 >> 8 ),
+                 static_cast<uint8_t>( FORMAT_VERSION_0 & 0xFF ),
+                 0,
+                 0 };
+    }
+
     std::vector<uint8_t> zlibDecompress( const uint8_t * src, const size_t srcSize, size_t realSize = 0 )
     {
         if ( src == nullptr || srcSize == 0 ) {
@@ -193,6 +219,283 @@ bool ZStreamBuf::write( const std::string & fn, const bool append /* = false */
     return !sf.fail();
 }
 
+struct ZStreamFile::DeflateState
+{
+    z_stream stream{};
+};
+
+ZStreamFile::ZStreamFile()
+    : _file( nullptr )
+    , _inputSize( 0 )
+    , _chunkOffset( 0 )
+    , _rawSize( 0 )
+    , _zipSize( 0 )
+{}
+
+ZStreamFile::~ZStreamFile()
+{
+    close();
+}
+
+bool ZStreamFile::open( const std::string & fn, const bool append /* = false */, const int compressionLevel /* = DEFAULT_COMPRESSION_LEVEL */ )
+{
+    close();
+
+    setfail( false );
+
+    // The header of the chunk is updated when the chunk is complete, so the file cannot be opened in append mode.
+    _file = std::fopen( fn.c_str(), append ? "r+b" : "wb" );
+    if ( _file == nullptr ) {
+        ERROR_LOG( fn )
+        return false;
+    }
+
+    if ( std::fseek( _file, 0, SEEK_END ) != 0 || ( _chunkOffset = std::ftell( _file ) ) < 0 ) {
+        ERROR_LOG( "Unable to find the end of the file " << fn )
+
+        std::fclose( _file );
+        _file = nullptr;
+
+        return false;
+    }
+
+    // Reserve space for the header of the chunk.
+    const std::array<uint8_t, CHUNK_HEADER_SIZE> header = getChunkHeader( 0, 0 );
+    if ( std::fwrite( header.data(), header.size(), 1, _file ) != 1 ) {
+        ERROR_LOG( "Unable to write to the file " << fn )
+
+        std::fclose( _file );
+        _file = nullptr;
+
+        return false;
+    }
+
+    _deflateState = std::make_unique<DeflateState>();
+
+    const int ret = deflateInit( &_deflateState->stream, compressionLevel );
+    if ( ret != Z_OK ) {
+        ERROR_LOG( "zlib error: " << ret )
+
+        _deflateState.reset();
+
+        std::fclose( _file );
+        _file = nullptr;
+
+        return false;
+    }
+
+    _input.resize( STREAM_INPUT_BUFFER_SIZE );
+    _output.resize( STREAM_OUTPUT_BUFFER_SIZE );
+    _inputSize = 0;
+    _rawSize = 0;
+    _zipSize = 0;
+
+    return true;
+}
+
+bool ZStreamFile::close()
+{
+    if ( _file == nullptr ) {
+        return false;
+    }
+
+    assert( _deflateState );
+
+    bool isSuccess = !fail() && deflateInput( Z_FINISH );
+
+    deflateEnd( &_deflateState->stream );
+    _deflateState.reset();
+
+    if ( isSuccess && ( _rawSize > std::numeric_limits<uint32_t>::max() || _zipSize > std::numeric_limits<uint32_t>::max() ) ) {
+        ERROR_LOG( "The size of the data is too large" )
+        isSuccess = false;
+    }
+
+    if ( isSuccess ) {
+        const std::array<uint8_t, CHUNK_HEADER_SIZE> header = getChunkHeader( static_cast<uint32_t>( _rawSize ), static_cast<uint32_t>( _zipSize ) );
+
+        isSuccess = std::fseek( _file, _chunkOffset, SEEK_SET ) == 0 && std::fwrite( header.data(), header.size(), 1, _file ) == 1;
+    }
+
+    isSuccess = ( std::fclose( _file ) == 0 ) && isSuccess;
+    _file = nullptr;
+
+    // Buffers are not needed anymore, release the memory.
+    std::vector<uint8_t>().swap( _input );
+    std::vector<uint8_t>().swap( _output );
+    _inputSize = 0;
+
+    if ( !isSuccess ) {
+        setfail( true );
+    }
+
+    return isSuccess;
+}
+
+bool ZStreamFile::deflateInput( const int flush )
+{
+    z_stream & stream = _deflateState->stream;
+
+    stream.next_in = _input.data();
+    stream.avail_in = static_cast<uInt>( _inputSize );
+
+    int ret = Z_OK;
+
+    do {
+        stream.next_out = _output.data();
+        stream.avail_out = static_cast<uInt>( _output.size() );
+
+        ret = deflate( &stream, flush );
+        if ( ret == Z_STREAM_ERROR ) {
+            ERROR_LOG( "zlib error: " << ret )
+            return false;
+        }
+
+        const size_t zipSize = _output.size() - stream.avail_out;
+        if ( zipSize > 0 && std::fwrite( _output.data(), zipSize, 1, _file ) != 1 ) {
+            ERROR_LOG( "Unable to write the compressed data" )
+            return false;
+        }
+
+        _zipSize += zipSize;
+    } while ( stream.avail_out == 0 );
+
+    assert( stream.avail_in == 0 );
+    assert( flush != Z_FINISH || ret == Z_STREAM_END );
+
+    _rawSize += _inputSize;
+    _inputSize = 0;
+
+    return true;
+}
+
+void ZStreamFile::put8( const uint8_t v )
+{
+    if ( _file == nullptr || fail() ) {
+        return;
+    }
+
+    if ( _inputSize == _input.size() && !deflateInput( Z_NO_FLUSH ) ) {
+        setfail( true );
+        return;
+    }
+
+    _input[_inputSize] = v;
+    ++_inputSize;
+}
+
+void ZStreamFile::putRaw( const char * ptr, size_t sz )
+{
+    while ( sz > 0 ) {
+        if ( _file == nullptr || fail() ) {
+            return;
+        }
+
+        if ( _inputSize == _input.size() && !deflateInput( Z_NO_FLUSH ) ) {
+            setfail( true );
+            return;
+        }
+
+        const size_t copySize = std::min( sz, _input.size() - _inputSize );
+        memcpy( _input.data() + _inputSize, ptr, copySize );
+
+        _inputSize += copySize;
+        ptr += copySize;
+        sz -= copySize;
+    }
+}
+
+void ZStreamFile::putBE16( uint16_t v )
+{
+    put8( v >> 8 );
+    put8( v & 0xFF );
+}
+
+void ZStreamFile::putLE16( uint16_t v )
+{
+    put8( v & 0xFF );
+    put8( v >> 8 );
+}
+
+void ZStreamFile::putBE32( uint32_t v )
+{
+    put8( v >> 24 );
+    put8( ( v >> 16 ) & 0xFF );
+    put8( ( v >> 8 ) & 0xFF );
+    put8( v & 0xFF );
+}
+
+void ZStreamFile::putLE32( uint32_t v )
+{
+    put8( v & 0xFF );
+    put8( ( v >> 8 ) & 0xFF );
+    put8( ( v >> 16 ) & 0xFF );
+    put8( v >> 24 );
+}
+
+// This stream is write-only: all reading operations fail.
+
+void ZStreamFile::skip( size_t /*unused*/ )
+{
+    setfail( true );
+}
+
+uint8_t ZStreamFile::get8()
+{
+    setfail( true );
+    return 0;
+}
+
+uint16_t ZStreamFile::getBE16()
+{
+    setfail( true );
+    return 0;
+}
+
+uint16_t ZStreamFile::getLE16()
+{
+    setfail( true );
+    return 0;
+}
+
+uint32_t ZStreamFile::getBE32()
+{
+    setfail( true );
+    return 0;
+}
+
+uint32_t ZStreamFile::getLE32()
+{
+    setfail( true );
+    return 0;
+}
+
+std::vector<uint8_t> ZStreamFile::getRaw( size_t /*unused*/ )
+{
+    setfail( true );
+    return {};
+}
+
+size_t ZStreamFile::sizeg() const
+{
+    return 0;
+}
+
+size_t ZStreamFile::sizep() const
+{
+    return std::numeric_limits<size_t>::max();
+}
+
+size_t ZStreamFile::tellg() const
+{
+    return 0;
+}
+
+size_t ZStreamFile::tellp() const
+{
+    return _rawSize + _inputSize;
+}
+
 fheroes2::Image CreateImageFromZlib( int32_t width, int32_t height, const uint8_t * imageData, size_t imageSize, bool doubleLayer )
 {
     if ( imageData == nullptr || imageSize == 0 || width <= 0 || height <= 0 )
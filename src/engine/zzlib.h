@@ -26,7 +26,10 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "image.h"
 #include "serialize.h"
@@ -47,6 +50,73 @@ public:
     bool write( const std::string & fn, const bool append = false ) const;
 };
 
+// Write-only stream which compresses the data on the fly and writes it to a file chunk by chunk. The result has the same format
+// as the one of ZStreamBuf::write() and can be read by ZStreamBuf::read(). Only fixed-size buffers are kept in memory no matter
+// how much data is written.
+class ZStreamFile : public StreamBase
+{
+public:
+    // zlib compression levels: 0 stores the data as is, 1 is the fastest and 9 gives the smallest output.
+    static constexpr int DEFAULT_COMPRESSION_LEVEL = -1;
+    static constexpr int FASTEST_COMPRESSION_LEVEL = 1;
+
+    ZStreamFile();
+    ZStreamFile( const ZStreamFile & ) = delete;
+
+    ~ZStreamFile() override;
+
+    ZStreamFile & operator=( const ZStreamFile & ) = delete;
+
+    // Creates the specified file (or opens the existing one to append the data to its end) and starts a new zipped chunk.
+    // Returns true on success or false on error.
+    bool open( const std::string & fn, const bool append = false, const int compressionLevel = DEFAULT_COMPRESSION_LEVEL );
+
+    // Compresses the remaining data, completes the header of the zipped chunk and closes the file. Returns true if all
+    // the data has been successfully written or false on error.
+    bool close();
+
+    void skip( size_t ) override;
+
+    uint16_t getBE16() override;
+    uint16_t getLE16() override;
+    uint32_t getBE32() override;
+    uint32_t getLE32() override;
+
+    void putBE32( uint32_t v ) override;
+    void putLE32( uint32_t v ) override;
+    void putBE16( uint16_t v ) override;
+    void putLE16( uint16_t v ) override;
+
+    std::vector<uint8_t> getRaw( size_t sz = 0 ) override;
+    void putRaw( const char * ptr, size_t sz ) override;
+
+protected:
+    size_t sizeg() const override;
+    size_t sizep() const override;
+    size_t tellg() const override;
+    size_t tellp() const override;
+
+    uint8_t get8() override;
+    void put8( const uint8_t v ) override;
+
+private:
+    struct DeflateState;
+
+    std::FILE * _file;
+    std::unique_ptr<DeflateState> _deflateState;
+
+    std::vector<uint8_t> _input;
+    std::vector<uint8_t> _output;
+    size_t _inputSize;
+
+    long _chunkOffset;
+    size_t _rawSize;
+    size_t _zipSize;
+
+    // Passes the buffered data to the compressor and writes all the compressed data it returns to the file.
+    bool deflateInput( const int flush );
+};
+
 fheroes2::Image CreateImageFromZlib( int32_t width, int32_t height, const uint8_t * imageData, size_t imageSize, bool doubleLayer );
 
 #endif
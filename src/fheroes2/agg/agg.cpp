@@ -22,6 +22,7 @@
  ***************************************************************************/
 
 #include <list>
+#include <mutex>
 #include <stdexcept>
 #include <utility>
 
@@ -35,16 +36,21 @@ namespace
 {
     fheroes2::AGGFile heroes2_agg;
     fheroes2::AGGFile heroes2x_agg;
+
+    // AGG files can be read from the ICN prefetching thread.
+    std::mutex aggFileMutex;
 }
 
-std::vector<uint8_t> AGG::getDataFromAggFile( const std::string & key )
+fheroes2::AGGFileData AGG::getDataFromAggFile( const std::string & key )
 {
+    const std::scoped_lock<std::mutex> lock( aggFileMutex );
+
     if ( heroes2x_agg.isGood() ) {
-        // Make sure that the below container is not const and not a reference
-        // so returning it from the function will invoke a move constructor instead of copy constructor.
-        std::vector<uint8_t> buf = heroes2x_agg.read( key );
-        if ( !buf.empty() )
-            return buf;
+        // Make sure that the below object is not const and not a reference
+        // so returning it from the function will invoke a move constructor.
+        fheroes2::AGGFileData data = heroes2x_agg.read( key );
+        if ( !data.empty() )
+            return data;
     }
 
     return heroes2_agg.read( key );
@@ -24,9 +24,9 @@
 #ifndef H2AGG_H
 #define H2AGG_H
 
-#include <cstdint>
 #include <string>
-#include <vector>
+
+#include "agg_file.h"
 
 namespace AGG
 {
@@ -56,7 +56,8 @@ namespace AGG
         std::string _expansionAGGFilePath;
     };
 
-    std::vector<uint8_t> getDataFromAggFile( const std::string & key );
+    // The returned data stays valid until the end of the application.
+    fheroes2::AGGFileData getDataFromAggFile( const std::string & key );
 }
 
 #endif
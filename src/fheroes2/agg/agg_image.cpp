@@ -24,10 +24,13 @@
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <initializer_list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <random>
 #include <set>
 #include <stdexcept>
@@ -43,11 +46,14 @@
 #include "icn.h"
 #include "image.h"
 #include "image_tool.h"
+#include "logging.h"
 #include "math_base.h"
 #include "pal.h"
 #include "rand.h"
 #include "screen.h"
 #include "serialize.h"
+#include "settings.h"
+#include "thread.h"
 #include "til.h"
 #include "tools.h"
 #include "translations.h"
@@ -68,6 +74,41 @@ namespace
 
     std::map<int, std::vector<fheroes2::Sprite>> _icnVsScaledSprite;
 
+    // Every access to an ICN or TIL is marked by an increasing counter value to find the least recently used resources.
+    uint64_t _accessCounter = 0;
+    std::vector<uint64_t> _icnLastAccess( ICN::LASTICN, 0 );
+    std::array<uint64_t, TIL::LASTTIL> _tilLastAccess{};
+
+    fheroes2::AGG::CacheStatistics _cacheStatistics;
+
+    // These ICNs are never evicted from the cache. Fonts are modified in place while generating alphabets,
+    // the rest are used on almost every screen of the game.
+    const std::set<int> pinnedIcnId{ ICN::FONT,
+                                     ICN::SMALFONT,
+                                     ICN::YELLOW_FONT,
+                                     ICN::YELLOW_SMALLFONT,
+                                     ICN::GRAY_FONT,
+                                     ICN::GRAY_SMALL_FONT,
+                                     ICN::WHITE_LARGE_FONT,
+                                     ICN::BUTTON_GOOD_FONT_RELEASED,
+                                     ICN::BUTTON_GOOD_FONT_PRESSED,
+                                     ICN::BUTTON_EVIL_FONT_RELEASED,
+                                     ICN::BUTTON_EVIL_FONT_PRESSED,
+                                     ICN::ADVMCO,
+                                     ICN::SPELCO,
+                                     ICN::CMSECO,
+                                     ICN::MONO_CURSOR_ADVMBW,
+                                     ICN::MONO_CURSOR_SPELBW,
+                                     ICN::MONO_CURSOR_CMSSBW,
+                                     ICN::COLOR_CURSOR_ADVENTURE_MAP,
+                                     ICN::MONO_CURSOR_ADVENTURE_MAP,
+                                     ICN::ADVBORD,
+                                     ICN::ADVBORDE,
+                                     ICN::ADVBTNS,
+                                     ICN::ADVEBTNS,
+                                     ICN::SYSTEM,
+                                     ICN::SYSTEME };
+
     // Some resources are language dependent. These are mostly buttons with a text of them.
     // Once a user changes a language we have to update resources. To do this we need to clear the existing images.
 
@@ -194,6 +235,41 @@ namespace
         return id >= 0 && static_cast<size_t>( id ) < _tilVsImage.size();
     }
 
+    size_t getImageMemorySize( const fheroes2::Image & image )
+    {
+        const size_t pixelCount = static_cast<size_t>( image.width() ) * static_cast<size_t>( image.height() );
+        return image.singleLayer() ? pixelCount : pixelCount * 2;
+    }
+
+    size_t getICNMemorySize( const int id )
+    {
+        size_t size = 0;
+        for ( const fheroes2::Sprite & sprite : _icnVsSprite[id] ) {
+            size += getImageMemorySize( sprite );
+        }
+
+        const auto scaledIter = _icnVsScaledSprite.find( id );
+        if ( scaledIter != _icnVsScaledSprite.end() ) {
+            for ( const fheroes2::Sprite & sprite : scaledIter->second ) {
+                size += getImageMemorySize( sprite );
+            }
+        }
+
+        return size;
+    }
+
+    size_t getTILMemorySize( const int id )
+    {
+        size_t size = 0;
+        for ( const std::vector<fheroes2::Image> & images : _tilVsImage[id] ) {
+            for ( const fheroes2::Image & image : images ) {
+                size += getImageMemorySize( image );
+            }
+        }
+
+        return size;
+    }
+
     fheroes2::Image createDigit( const int32_t width, const int32_t height, const std::vector<fheroes2::Point> & points, const uint8_t pixelColor )
     {
         fheroes2::Image digit( width, height );
@@ -243,13 +319,13 @@ namespace
     // BMP files within AGG are not Bitmap files.
     fheroes2::Sprite loadBMPFile( const std::string & path )
     {
-        const std::vector<uint8_t> & data = AGG::getDataFromAggFile( path );
+        const fheroes2::AGGFileData data = AGG::getDataFromAggFile( path );
         if ( data.size() < 6 ) {
             // It is an invalid BMP file.
             return {};
         }
 
-        StreamBuf imageStream( data );
+        StreamBuf imageStream( data.data(), data.size() );
 
         const uint8_t blackColor = imageStream.get();
 
@@ -540,56 +616,217 @@ namespace
         std::fill( imageTransform + ( imageHeight - 1 ) * imageWidth - 3, imageTransform + ( imageHeight - 1 ) * imageWidth, transparencyValue );
         std::fill( imageTransform + imageHeight * imageWidth - 4, imageTransform + imageHeight * imageWidth, transparencyValue );
     }
-}
 
-namespace fheroes2
-{
-    namespace AGG
+    // Decodes all images of an ICN stored in AGG files. This function can be called from any thread.
+    std::vector<fheroes2::Sprite> decodeOriginalICN( const int id )
     {
-        void LoadOriginalICN( const int id )
+        const fheroes2::AGGFileData body = ::AGG::getDataFromAggFile( ICN::GetString( id ) );
+
+        if ( body.empty() ) {
+            return {};
+        }
+
+        StreamBuf imageStream( body.data(), body.size() );
+
+        const uint32_t count = imageStream.getLE16();
+        const uint32_t blockSize = imageStream.getLE32();
+        if ( count == 0 || blockSize == 0 ) {
+            return {};
+        }
+
+        std::vector<fheroes2::Sprite> sprites( count );
+
+        for ( uint32_t i = 0; i < count; ++i ) {
+            imageStream.seek( headerSize + i * 13 );
+
+            fheroes2::ICNHeader header1;
+            imageStream >> header1;
+
+            uint32_t sizeData = 0;
+            if ( i + 1 != count ) {
+                fheroes2::ICNHeader header2;
+                imageStream >> header2;
+                sizeData = header2.offsetData - header1.offsetData;
+            }
+            else {
+                sizeData = blockSize - header1.offsetData;
+            }
+
+            if ( headerSize + header1.offsetData + sizeData > body.size() ) {
+                // This is a corrupted AGG file.
+                throw fheroes2::InvalidDataResources( "ICN Id " + std::to_string( id ) + ", index " + std::to_string( i )
+                                                      + " is being corrupted. "
+                                                        "Make sure that you own an official version of the game." );
+            }
+
+            const uint8_t * data = body.data() + headerSize + header1.offsetData;
+
+            sprites[i] = fheroes2::decodeICNSprite( data, sizeData, header1.width, header1.height, header1.offsetX, header1.offsetY );
+        }
+
+        return sprites;
+    }
+
+    // Decodes ICNs in a background thread before they are requested by GetICN() function.
+    // Decoded images are handed over to the main thread only when they are being loaded.
+    class ICNPrefetchManager final : public MultiThreading::AsyncManager
+    {
+    public:
+        void pushICN( const int icnId )
         {
-            const std::vector<uint8_t> & body = ::AGG::getDataFromAggFile( ICN::GetString( id ) );
+            createWorker();
+
+            const std::scoped_lock<std::mutex> lock( _mutex );
 
-            if ( body.empty() ) {
+            if ( icnId == _currentIcnId || _decodedIcns.count( icnId ) > 0 || std::find( _icnIdsToDecode.begin(), _icnIdsToDecode.end(), icnId ) != _icnIdsToDecode.end() ) {
                 return;
             }
 
-            StreamBuf imageStream( body );
+            _icnIdsToDecode.push_back( icnId );
 
-            const uint32_t count = imageStream.getLE16();
-            const uint32_t blockSize = imageStream.getLE32();
-            if ( count == 0 || blockSize == 0 ) {
-                return;
+            notifyWorker();
+        }
+
+        // Returns true if the ICN has been decoded in the background. If the ICN is being decoded at the moment, waits for it.
+        bool takeDecodedICN( const int icnId, std::vector<fheroes2::Sprite> & sprites )
+        {
+            std::unique_lock<std::mutex> lock( _mutex );
+
+            // The ICN is going to be loaded right now so there is no need to decode it in the background.
+            _icnIdsToDecode.erase( std::remove( _icnIdsToDecode.begin(), _icnIdsToDecode.end(), icnId ), _icnIdsToDecode.end() );
+
+            _decodingFinished.wait( lock, [this, icnId] { return _currentIcnId != icnId; } );
+
+            auto iter = _decodedIcns.find( icnId );
+            if ( iter == _decodedIcns.end() ) {
+                return false;
             }
 
-            _icnVsSprite[id].resize( count );
+            sprites = std::move( iter->second );
+            _decodedIcns.erase( iter );
 
-            for ( uint32_t i = 0; i < count; ++i ) {
-                imageStream.seek( headerSize + i * 13 );
+            return true;
+        }
 
-                ICNHeader header1;
-                imageStream >> header1;
+        // Drops all ICNs which have been decoded but not requested yet.
+        void removeDecodedICNs()
+        {
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
+            _decodedIcns.clear();
+        }
+
+        // Drops all decoded and queued ICNs except the given ones. Used when a new screen is going to replace a previous prefetched one.
+        void removeOtherICNs( const std::vector<int> & icnIds )
+        {
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
+            const auto isNotRequested = [&icnIds]( const int icnId ) { return std::find( icnIds.begin(), icnIds.end(), icnId ) == icnIds.end(); };
 
-                uint32_t sizeData = 0;
-                if ( i + 1 != count ) {
-                    ICNHeader header2;
-                    imageStream >> header2;
-                    sizeData = header2.offsetData - header1.offsetData;
+            _icnIdsToDecode.erase( std::remove_if( _icnIdsToDecode.begin(), _icnIdsToDecode.end(), isNotRequested ), _icnIdsToDecode.end() );
+
+            for ( auto iter = _decodedIcns.begin(); iter != _decodedIcns.end(); ) {
+                if ( isNotRequested( iter->first ) ) {
+                    iter = _decodedIcns.erase( iter );
                 }
                 else {
-                    sizeData = blockSize - header1.offsetData;
+                    ++iter;
                 }
+            }
+        }
+
+        size_t getDecodedICNsMemorySize()
+        {
+            const std::scoped_lock<std::mutex> lock( _mutex );
 
-                if ( headerSize + header1.offsetData + sizeData > body.size() ) {
-                    // This is a corrupted AGG file.
-                    throw fheroes2::InvalidDataResources( "ICN Id " + std::to_string( id ) + ", index " + std::to_string( i )
-                                                          + " is being corrupted. "
-                                                            "Make sure that you own an official version of the game." );
+            size_t size = 0;
+            for ( const auto & [icnId, sprites] : _decodedIcns ) {
+                for ( const fheroes2::Sprite & sprite : sprites ) {
+                    size += getImageMemorySize( sprite );
                 }
+            }
+
+            return size;
+        }
+
+        void removeAllTasks()
+        {
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
+            _icnIdsToDecode.clear();
+            _decodedIcns.clear();
+        }
+
+    private:
+        std::deque<int> _icnIdsToDecode;
+        std::map<int, std::vector<fheroes2::Sprite>> _decodedIcns;
+
+        // ICN being decoded by the worker thread at the moment. It can be read by other threads only when _mutex is acquired.
+        int _currentIcnId{ -1 };
+
+        std::condition_variable _decodingFinished;
 
-                const uint8_t * data = body.data() + headerSize + header1.offsetData;
+        // This method is called by the worker thread and is protected by _mutex
+        bool prepareTask() override
+        {
+            if ( _icnIdsToDecode.empty() ) {
+                _currentIcnId = -1;
 
-                _icnVsSprite[id][i] = decodeICNSprite( data, sizeData, header1.width, header1.height, header1.offsetX, header1.offsetY );
+                return false;
+            }
+
+            _currentIcnId = _icnIdsToDecode.front();
+            _icnIdsToDecode.pop_front();
+
+            return true;
+        }
+
+        // This method is called by the worker thread, but is not protected by _mutex
+        void executeTask() override
+        {
+            if ( _currentIcnId < 0 ) {
+                return;
+            }
+
+            std::vector<fheroes2::Sprite> sprites;
+
+            try {
+                sprites = decodeOriginalICN( _currentIcnId );
+            }
+            catch ( const fheroes2::InvalidDataResources & ) {
+                // The main thread will decode this ICN again and report the error.
+            }
+
+            {
+                const std::scoped_lock<std::mutex> lock( _mutex );
+
+                if ( !sprites.empty() ) {
+                    _decodedIcns[_currentIcnId] = std::move( sprites );
+                }
+
+                _currentIcnId = -1;
+            }
+
+            _decodingFinished.notify_all();
+        }
+    };
+
+    ICNPrefetchManager icnPrefetchManager;
+}
+
+namespace fheroes2
+{
+    namespace AGG
+    {
+        void LoadOriginalICN( const int id )
+        {
+            std::vector<Sprite> sprites;
+            if ( !icnPrefetchManager.takeDecodedICN( id, sprites ) ) {
+                sprites = decodeOriginalICN( id );
+            }
+
+            if ( !sprites.empty() ) {
+                _icnVsSprite[id] = std::move( sprites );
             }
         }
 
@@ -2309,7 +2546,7 @@ namespace fheroes2
                     throw std::logic_error( "The game resources are corrupted. Please use resources from a licensed version of Heroes of Might and Magic II." );
                 }
 
-                const std::vector<uint8_t> & body = ::AGG::getDataFromAggFile( ICN::GetString( id ) );
+                const AGGFileData body = ::AGG::getDataFromAggFile( ICN::GetString( id ) );
                 const uint32_t crc32 = fheroes2::calculateCRC32( body.data(), body.size() );
 
                 if ( id == ICN::SMALFONT ) {
@@ -4242,14 +4479,14 @@ namespace fheroes2
             if ( _tilVsImage[id].empty() ) {
                 _tilVsImage[id].resize( 4 ); // 4 possible sides
 
-                const std::vector<uint8_t> & data = ::AGG::getDataFromAggFile( tilFileName[id] );
+                const AGGFileData data = ::AGG::getDataFromAggFile( tilFileName[id] );
                 if ( data.size() < headerSize ) {
                     // The important resource is absent! Make sure that you are using the correct version of the game.
                     assert( 0 );
                     return 0;
                 }
 
-                StreamBuf buffer( data );
+                StreamBuf buffer( data.data(), data.size() );
 
                 const size_t count = buffer.getLE16();
                 const int32_t width = buffer.getLE16();
@@ -4336,13 +4573,49 @@ namespace fheroes2
             return resizedIcn;
         }
 
+        // Loads the ICN if it is not in the cache yet and returns the number of its images.
+        size_t accessICN( const int id )
+        {
+            _icnLastAccess[id] = ++_accessCounter;
+
+            if ( !_icnVsSprite[id].empty() ) {
+                ++_cacheStatistics.hits;
+                return _icnVsSprite[id].size();
+            }
+
+            ++_cacheStatistics.misses;
+
+            const size_t count = GetMaximumICNIndex( id );
+            _cacheStatistics.decodedBytes += getICNMemorySize( id );
+
+            return count;
+        }
+
+        // Loads the TIL if it is not in the cache yet and returns the number of its images.
+        size_t accessTIL( const int id )
+        {
+            _tilLastAccess[id] = ++_accessCounter;
+
+            if ( !_tilVsImage[id].empty() ) {
+                ++_cacheStatistics.hits;
+                return _tilVsImage[id][0].size();
+            }
+
+            ++_cacheStatistics.misses;
+
+            const size_t count = GetMaximumTILIndex( id );
+            _cacheStatistics.decodedBytes += getTILMemorySize( id );
+
+            return count;
+        }
+
         const Sprite & GetICN( int icnId, uint32_t index )
         {
             if ( !IsValidICNId( icnId ) ) {
                 return errorImage;
             }
 
-            if ( index >= GetMaximumICNIndex( icnId ) ) {
+            if ( index >= accessICN( icnId ) ) {
                 return errorImage;
             }
 
@@ -4359,7 +4632,7 @@ namespace fheroes2
                 return 0;
             }
 
-            return static_cast<uint32_t>( GetMaximumICNIndex( icnId ) );
+            return static_cast<uint32_t>( accessICN( icnId ) );
         }
 
         const Image & GetTIL( int tilId, uint32_t index, uint32_t shapeId )
@@ -4372,7 +4645,7 @@ namespace fheroes2
                 return errorImage;
             }
 
-            const size_t maxTILIndex = GetMaximumTILIndex( tilId );
+            const size_t maxTILIndex = accessTIL( tilId );
             if ( index >= maxTILIndex ) {
                 return errorImage;
             }
@@ -4520,5 +4793,117 @@ namespace fheroes2
                 _icnVsSprite[id].clear();
             }
         }
+
+        void enforceCacheBudget()
+        {
+            // Images prefetched for the previous game mode but never requested by it are not going to be used.
+            icnPrefetchManager.removeAllTasks();
+
+            const size_t cacheBudget = static_cast<size_t>( Settings::Get().imageCacheSize() ) * 1024 * 1024;
+            if ( cacheBudget == 0 ) {
+                return;
+            }
+
+            struct CacheEntry
+            {
+                uint64_t lastAccess;
+                int id;
+                bool isTIL;
+                size_t size;
+            };
+
+            std::vector<CacheEntry> entries;
+
+            // An ICN which was being decoded during the cleanup above is still kept by the prefetch manager.
+            const size_t prefetchedBytes = icnPrefetchManager.getDecodedICNsMemorySize();
+            size_t cachedBytes = prefetchedBytes;
+
+            for ( int id = 0; id < static_cast<int>( _icnVsSprite.size() ); ++id ) {
+                if ( _icnVsSprite[id].empty() ) {
+                    continue;
+                }
+
+                const size_t size = getICNMemorySize( id );
+                cachedBytes += size;
+
+                if ( pinnedIcnId.count( id ) == 0 ) {
+                    entries.push_back( { _icnLastAccess[id], id, false, size } );
+                }
+            }
+
+            for ( int id = 0; id < static_cast<int>( _tilVsImage.size() ); ++id ) {
+                if ( _tilVsImage[id].empty() ) {
+                    continue;
+                }
+
+                const size_t size = getTILMemorySize( id );
+                cachedBytes += size;
+                entries.push_back( { _tilLastAccess[id], id, true, size } );
+            }
+
+            if ( cachedBytes <= cacheBudget ) {
+                return;
+            }
+
+            icnPrefetchManager.removeDecodedICNs();
+            cachedBytes -= prefetchedBytes;
+
+            std::sort( entries.begin(), entries.end(), []( const CacheEntry & first, const CacheEntry & second ) { return first.lastAccess < second.lastAccess; } );
+
+            for ( const CacheEntry & entry : entries ) {
+                if ( cachedBytes <= cacheBudget ) {
+                    break;
+                }
+
+                if ( entry.isTIL ) {
+                    std::vector<std::vector<Image>>().swap( _tilVsImage[entry.id] );
+                }
+                else {
+                    std::vector<Sprite>().swap( _icnVsSprite[entry.id] );
+                    _icnVsScaledSprite.erase( entry.id );
+                }
+
+                cachedBytes -= entry.size;
+            }
+
+            DEBUG_LOG( DBG_ENGINE, DBG_INFO,
+                       "Image cache has been reduced to " << cachedBytes << " bytes, budget: " << cacheBudget << " bytes, hits: " << _cacheStatistics.hits
+                                                          << ", misses: " << _cacheStatistics.misses << ", decoded: " << _cacheStatistics.decodedBytes << " bytes" )
+        }
+
+        void prefetchICNs( const std::vector<int> & icnIds )
+        {
+            // Prefetched images of the previous screen which have not been requested are not needed anymore.
+            icnPrefetchManager.removeOtherICNs( icnIds );
+
+            for ( const int icnId : icnIds ) {
+                // Only ICNs stored in AGG files without any modifications can be decoded in the background.
+                if ( icnId > ICN::UNKNOWN && icnId < ICN::LAST_VALID_FILE_ICN && _icnVsSprite[icnId].empty() ) {
+                    icnPrefetchManager.pushICN( icnId );
+                }
+            }
+        }
+
+        void stopPrefetching()
+        {
+            icnPrefetchManager.removeAllTasks();
+            icnPrefetchManager.stopWorker();
+        }
+
+        CacheStatistics getCacheStatistics()
+        {
+            CacheStatistics statistics = _cacheStatistics;
+            statistics.cachedBytes = icnPrefetchManager.getDecodedICNsMemorySize();
+
+            for ( int id = 0; id < static_cast<int>( _icnVsSprite.size() ); ++id ) {
+                statistics.cachedBytes += getICNMemorySize( id );
+            }
+
+            for ( int id = 0; id < static_cast<int>( _tilVsImage.size() ); ++id ) {
+                statistics.cachedBytes += getTILMemorySize( id );
+            }
+
+            return statistics;
+        }
     }
 }
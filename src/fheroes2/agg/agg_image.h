@@ -20,7 +20,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace fheroes2
 {
@@ -32,6 +34,18 @@ namespace fheroes2
 
     namespace AGG
     {
+        struct CacheStatistics
+        {
+            uint64_t hits{ 0 };
+            uint64_t misses{ 0 };
+
+            // The total size of all images decoded since the start of the game, including evicted ones.
+            uint64_t decodedBytes{ 0 };
+
+            // The size of images being currently kept in memory.
+            size_t cachedBytes{ 0 };
+        };
+
         const Sprite & GetICN( int icnId, uint32_t index );
         uint32_t GetICNCount( int icnId );
 
@@ -45,5 +59,19 @@ namespace fheroes2
 
         // This function must be called only at the type of setting up a new language.
         void updateLanguageDependentResources( const SupportedLanguage language, const bool loadOriginalAlphabet );
+
+        // Evicts the least recently used ICNs and TILs until the size of decoded images fits into the limit set in the game settings.
+        // Fonts, cursors and the main interface elements are never evicted. All references to evicted images become invalid,
+        // so this function must be called only when nobody holds them, like between switching game modes.
+        void enforceCacheBudget();
+
+        CacheStatistics getCacheStatistics();
+
+        // Decodes the given ICNs in a background thread so the following GetICN() calls for them would not spend time on decoding.
+        // Call this function ahead of opening a screen which uses many images. Prefetched images of other ICNs which have not been requested yet are dropped.
+        void prefetchICNs( const std::vector<int> & icnIds );
+
+        // This function must be called before AGG resources are released.
+        void stopPrefetching();
     }
 }
@@ -71,7 +71,7 @@ namespace Bin_Info
         return fheroes2::getMonsterData( monsterId ).binFileName;
     }
 
-    MonsterAnimInfo::MonsterAnimInfo( int monsterID, const std::vector<uint8_t> & bytes )
+    MonsterAnimInfo::MonsterAnimInfo( int monsterID, const uint8_t * data, const size_t size )
         : moveSpeed( 450 )
         , shootSpeed( 0 )
         , flightSpeed( 0 )
@@ -80,12 +80,10 @@ namespace Bin_Info
         , idleAnimationCount( 0 )
         , idleAnimationDelay( 0 )
     {
-        if ( bytes.size() != Bin_Info::CORRECT_FRM_LENGTH ) {
+        if ( data == nullptr || size != Bin_Info::CORRECT_FRM_LENGTH ) {
             return;
         }
 
-        const uint8_t * data = bytes.data();
-
         eyePosition = { getValue<int16_t>( data, 1 ), getValue<int16_t>( data, 3 ) };
 
         for ( size_t moveID = 0; moveID < 7; ++moveID ) {
@@ -465,7 +463,8 @@ namespace Bin_Info
             return mapIterator->second;
         }
         else {
-            const MonsterAnimInfo info( monsterID, AGG::getDataFromAggFile( Bin_Info::GetFilename( monsterID ) ) );
+            const fheroes2::AGGFileData data = AGG::getDataFromAggFile( Bin_Info::GetFilename( monsterID ) );
+            const MonsterAnimInfo info( monsterID, data.data(), data.size() );
             if ( info.isValid() ) {
                 _animMap[monsterID] = info;
                 return info;
@@ -84,7 +84,7 @@ namespace Bin_Info
         uint32_t idleAnimationDelay;
         std::vector<std::vector<int>> animationFrames;
 
-        MonsterAnimInfo( int monsterID = 0, const std::vector<uint8_t> & bytes = std::vector<uint8_t>() );
+        MonsterAnimInfo( int monsterID = 0, const uint8_t * data = nullptr, const size_t size = 0 );
         bool hasAnim( int animID = MonsterAnimInfo::STATIC ) const;
         bool isValid() const;
         size_t getProjectileID( const double angle ) const;
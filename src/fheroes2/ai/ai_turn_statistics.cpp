@@ -0,0 +1,142 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "ai_turn_statistics.h"
+
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+#include "color.h"
+#include "logging.h"
+#include "settings.h"
+#include "world.h"
+
+namespace
+{
+    const size_t phaseCount = static_cast<size_t>( AI::TurnPhase::NONE );
+
+    const std::array<const char *, phaseCount> phaseNames = { "pathfinding", "object_valuation", "castle_turn", "battle" };
+
+    struct TurnStatistics
+    {
+        bool isActive = false;
+        int color = Color::NONE;
+
+        AI::TurnPhase currentPhase = AI::TurnPhase::NONE;
+
+        std::chrono::steady_clock::time_point turnStartTime;
+        std::chrono::steady_clock::time_point phaseStartTime;
+
+        std::array<std::chrono::steady_clock::duration, phaseCount> phaseDuration{};
+        std::array<uint32_t, phaseCount> phaseCalls{};
+    };
+
+    TurnStatistics turnStatistics;
+
+    void switchPhase( const AI::TurnPhase phase )
+    {
+        const std::chrono::steady_clock::time_point currentTime = std::chrono::steady_clock::now();
+
+        if ( turnStatistics.currentPhase != AI::TurnPhase::NONE ) {
+            turnStatistics.phaseDuration[static_cast<size_t>( turnStatistics.currentPhase )] += currentTime - turnStatistics.phaseStartTime;
+        }
+
+        turnStatistics.currentPhase = phase;
+        turnStatistics.phaseStartTime = currentTime;
+    }
+
+    double toMilliseconds( const std::chrono::steady_clock::duration duration )
+    {
+        return std::chrono::duration<double, std::milli>( duration ).count();
+    }
+}
+
+namespace AI
+{
+    TurnPhaseTimer::TurnPhaseTimer( const TurnPhase phase )
+        : _isActive( turnStatistics.isActive )
+        , _previousPhase( turnStatistics.currentPhase )
+    {
+        assert( phase != TurnPhase::NONE );
+
+        if ( !_isActive ) {
+            return;
+        }
+
+        switchPhase( phase );
+        ++turnStatistics.phaseCalls[static_cast<size_t>( phase )];
+    }
+
+    TurnPhaseTimer::~TurnPhaseTimer()
+    {
+        if ( _isActive && turnStatistics.isActive ) {
+            switchPhase( _previousPhase );
+        }
+    }
+
+    void startTurnStatistics( const int color )
+    {
+        if ( !Settings::Get().isAITurnStatisticsEnabled() ) {
+            return;
+        }
+
+        turnStatistics = {};
+        turnStatistics.isActive = true;
+        turnStatistics.color = color;
+        turnStatistics.turnStartTime = std::chrono::steady_clock::now();
+    }
+
+    void finishTurnStatistics()
+    {
+        if ( !turnStatistics.isActive ) {
+            return;
+        }
+
+        // All phase timers must be destroyed by this moment.
+        assert( turnStatistics.currentPhase == TurnPhase::NONE );
+
+        const std::chrono::steady_clock::duration turnDuration = std::chrono::steady_clock::now() - turnStatistics.turnStartTime;
+
+        std::ostringstream os;
+        os << std::fixed << std::setprecision( 3 );
+        os << "{\"day\":" << world.CountDay() << ",\"seed\":" << world.GetMapSeed() << ",\"color\":\"" << Color::String( turnStatistics.color )
+           << "\",\"total_ms\":" << toMilliseconds( turnDuration ) << ",\"phases\":{";
+
+        for ( size_t i = 0; i < phaseCount; ++i ) {
+            if ( i > 0 ) {
+                os << ',';
+            }
+
+            os << '"' << phaseNames[i] << "\":{\"ms\":" << toMilliseconds( turnStatistics.phaseDuration[i] ) << ",\"calls\":" << turnStatistics.phaseCalls[i] << '}';
+        }
+
+        os << "}}";
+
+        COUT( os.str() )
+
+        turnStatistics.isActive = false;
+    }
+}
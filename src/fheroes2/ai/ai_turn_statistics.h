@@ -0,0 +1,63 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef H2AI_TURN_STATISTICS_H
+#define H2AI_TURN_STATISTICS_H
+
+#include <cstdint>
+
+namespace AI
+{
+    enum class TurnPhase : uint8_t
+    {
+        PATHFINDING,
+        OBJECT_VALUATION,
+        CASTLE_TURN,
+        BATTLE,
+
+        // IMPORTANT!!! Put all new entries above this line.
+        NONE
+    };
+
+    // Measures the time spent in the given phase of the AI turn. Measurements are exclusive: while a nested timer is alive
+    // its time is not counted for the enclosing phase. Does nothing if the turn statistics are not being collected.
+    class TurnPhaseTimer
+    {
+    public:
+        explicit TurnPhaseTimer( const TurnPhase phase );
+        TurnPhaseTimer( const TurnPhaseTimer & ) = delete;
+
+        ~TurnPhaseTimer();
+
+        TurnPhaseTimer & operator=( const TurnPhaseTimer & ) = delete;
+
+    private:
+        const bool _isActive;
+        const TurnPhase _previousPhase;
+    };
+
+    // Starts collecting the statistics of the turn of the given kingdom if it is enabled in the settings.
+    void startTurnStatistics( const int color );
+
+    // Writes the collected statistics into the log as a single line of JSON and stops collecting them.
+    void finishTurnStatistics();
+}
+
+#endif
@@ -45,6 +45,19 @@ namespace AI
     void Normal::resetPathfinder()
     {
         _pathfinder.reset();
+
+        for ( auto & [hero, pathfinder] : _heroPathfinders ) {
+            pathfinder.reset();
+        }
+    }
+
+    void Normal::updatePathfinder( const int32_t tileIndex )
+    {
+        _pathfinder.invalidateTile( tileIndex );
+
+        for ( auto & [hero, pathfinder] : _heroPathfinders ) {
+            pathfinder.invalidateTile( tileIndex );
+        }
     }
 
     void Normal::revealFog( const Maps::Tiles & tile, const Kingdom & kingdom )
@@ -282,7 +282,12 @@ namespace AI
         bool isValidHeroObject( const Heroes & hero, const int32_t index, const bool underHero ) override;
         double getObjectValue( const Heroes & hero, const int index, const int objectType, const double valueToIgnore, const uint32_t distanceToObject ) const;
         int getPriorityTarget( const HeroToMove & heroInfo, double & maxPriority );
+
+        // Returns the pathfinder that should be used to search for the hero's target. Its settings are synchronized with the settings of
+        // the main pathfinder.
+        AIWorldPathfinder & getHeroPathfinder( const Heroes & hero );
         void resetPathfinder() override;
+        void updatePathfinder( const int32_t tileIndex ) override;
 
         void battleBegins() override;
 
@@ -316,6 +321,10 @@ namespace AI
         AIWorldPathfinder _pathfinder;
         BattlePlanner _battlePlanner;
 
+        // Each hero uses its own pathfinder while searching for a target, so that the pathfinder of the hero who has not moved can be
+        // re-evaluated only partially (when some other hero has moved or some object has been removed from the map)
+        std::map<const Heroes *, AIWorldPathfinder> _heroPathfinders;
+
         // Monster strength is constant over the same turn for AI but its calculation is a heavy operation.
         // In order to avoid extra computations during AI turn it is important to keep cache of monster strength but update it when an action on a monster is taken.
         std::map<int32_t, double> _neutralMonsterStrengthCache;
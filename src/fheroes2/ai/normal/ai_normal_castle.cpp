@@ -25,6 +25,7 @@
 
 #include "ai.h"
 #include "ai_normal.h"
+#include "ai_turn_statistics.h"
 #include "army.h"
 #include "army_troop.h"
 #include "battle_tower.h"
@@ -240,6 +241,8 @@ namespace AI
 
     void Normal::CastleTurn( Castle & castle, const bool defensiveStrategy )
     {
+        const TurnPhaseTimer phaseTimer( TurnPhase::CASTLE_TURN );
+
         if ( defensiveStrategy ) {
             // Avoid building monster dwellings when defensive as they might fall into enemy's hands, unless we have a lot of resources.
             const Kingdom & kingdom = castle.GetKingdom();
@@ -36,6 +36,7 @@
 
 #include "ai.h"
 #include "ai_normal.h"
+#include "ai_turn_statistics.h"
 #include "army.h"
 #include "army_troop.h"
 #include "artifact.h"
@@ -1883,6 +1884,8 @@ namespace AI
 
     int Normal::getPriorityTarget( const HeroToMove & heroInfo, double & maxPriority )
     {
+        const TurnPhaseTimer phaseTimer( TurnPhase::OBJECT_VALUATION );
+
         Heroes & hero = *heroInfo.hero;
 
         DEBUG_LOG( DBG_AI, DBG_INFO, "Find Adventure Map target for hero " << hero.GetName() << " at current position " << hero.GetIndex() )
@@ -1913,17 +1916,19 @@ namespace AI
         }
 #endif
 
+        AIWorldPathfinder & pathfinder = getHeroPathfinder( hero );
+
         // pre-cache the pathfinder
-        _pathfinder.reEvaluateIfNeeded( hero );
+        pathfinder.reEvaluateIfNeeded( hero );
 
-        ObjectValidator objectValidator( hero, _pathfinder, *this );
+        ObjectValidator objectValidator( hero, pathfinder, *this );
         ObjectValueStorage valueStorage( hero, *this, lowestPossibleValue );
 
-        const auto getObjectValue = [&objectValidator, &valueStorage, this, heroStrength, &hero]( const int destination, uint32_t & distance, double & value,
-                                                                                                  const MP2::MapObjectType type, const bool isDimensionDoor ) {
+        const auto getObjectValue = [&objectValidator, &valueStorage, &pathfinder, this, heroStrength, &hero]( const int destination, uint32_t & distance, double & value,
+                                                                                                               const MP2::MapObjectType type, const bool isDimensionDoor ) {
             if ( !isDimensionDoor ) {
                 // Dimension door path does not include any objects on the way.
-                std::vector<IndexObject> list = _pathfinder.getObjectsOnTheWay( destination );
+                std::vector<IndexObject> list = pathfinder.getObjectsOnTheWay( destination );
                 for ( const IndexObject & pair : list ) {
                     if ( objectValidator.isValid( pair.first ) && std::binary_search( _mapActionObjects.begin(), _mapActionObjects.end(), pair ) ) {
                         const double extraValue = valueStorage.value( pair, 0 ); // object is on the way, we don't loose any movement points.
@@ -2017,7 +2022,7 @@ namespace AI
 
         // Set baseline target if it's a special role
         if ( hero.getAIRole() == Heroes::Role::COURIER ) {
-            const int courierTarget = getCourierMainTarget( hero, _pathfinder, lowestPossibleValue );
+            const int courierTarget = getCourierMainTarget( hero, pathfinder, lowestPossibleValue );
             if ( courierTarget != -1 ) {
                 // Anything with positive value can override the courier's main task (i.e. castle or mine capture on the way)
                 maxPriority = 0;
@@ -2040,10 +2045,10 @@ namespace AI
                 continue;
 
             if ( objectValidator.isValid( node.first ) ) {
-                uint32_t dist = _pathfinder.getDistance( node.first );
+                uint32_t dist = pathfinder.getDistance( node.first );
 
                 bool useDimensionDoor = false;
-                const uint32_t dimensionDoorDist = Route::calculatePathPenalty( _pathfinder.getDimensionDoorPath( hero, node.first ) );
+                const uint32_t dimensionDoorDist = Route::calculatePathPenalty( pathfinder.getDimensionDoorPath( hero, node.first ) );
                 if ( dimensionDoorDist > 0 && ( dist == 0 || dimensionDoorDist < dist / 2 ) ) {
                     dist = dimensionDoorDist;
                     useDimensionDoor = true;
@@ -2072,13 +2077,13 @@ namespace AI
 
         double fogDiscoveryValue = getFogDiscoveryValue( hero );
         bool isTerritoryExpansion = false;
-        const int fogDiscoveryTarget = _pathfinder.getFogDiscoveryTile( hero, isTerritoryExpansion );
+        const int fogDiscoveryTarget = pathfinder.getFogDiscoveryTile( hero, isTerritoryExpansion );
         if ( fogDiscoveryTarget >= 0 ) {
-            uint32_t distanceToFogDiscovery = _pathfinder.getDistance( fogDiscoveryTarget );
+            uint32_t distanceToFogDiscovery = pathfinder.getDistance( fogDiscoveryTarget );
 
             // TODO: add logic to check fog discovery based on Dimension Door distance, not the nearest tile.
             bool useDimensionDoor = false;
-            const uint32_t dimensionDoorDist = Route::calculatePathPenalty( _pathfinder.getDimensionDoorPath( hero, fogDiscoveryTarget ) );
+            const uint32_t dimensionDoorDist = Route::calculatePathPenalty( pathfinder.getDimensionDoorPath( hero, fogDiscoveryTarget ) );
             if ( dimensionDoorDist > 0 && ( distanceToFogDiscovery == 0 || dimensionDoorDist < distanceToFogDiscovery / 2 ) ) {
                 distanceToFogDiscovery = dimensionDoorDist;
                 useDimensionDoor = true;
@@ -2115,6 +2120,22 @@ namespace AI
         return priorityTarget;
     }
 
+    AIWorldPathfinder & Normal::getHeroPathfinder( const Heroes & hero )
+    {
+        const auto [iter, inserted] = _heroPathfinders.try_emplace( &hero, _pathfinder.getMinimalArmyStrengthAdvantage() );
+
+        AIWorldPathfinder & pathfinder = iter->second;
+
+        if ( inserted ) {
+            pathfinder.reset();
+        }
+
+        pathfinder.setMinimalArmyStrengthAdvantage( _pathfinder.getMinimalArmyStrengthAdvantage() );
+        pathfinder.setSpellPointsReserveRatio( _pathfinder.getSpellPointsReserveRatio() );
+
+        return pathfinder;
+    }
+
     void Normal::updatePriorityTargets( Heroes & hero, int32_t tileIndex, const MP2::MapObjectType objectType )
     {
         if ( objectType != MP2::OBJ_CASTLE && objectType != MP2::OBJ_HEROES ) {
@@ -2525,6 +2546,9 @@ namespace AI
             }
         }
 
+        // These pathfinders are no longer needed and occupy a lot of memory on large maps
+        _heroPathfinders.clear();
+
         status.DrawAITurnProgress( endProgressValue );
 
         return availableHeroes.empty();
@@ -34,6 +34,7 @@
 
 #include "ai.h"
 #include "ai_normal.h"
+#include "ai_turn_statistics.h"
 #include "army.h"
 #include "army_troop.h"
 #include "audio.h"
@@ -709,6 +710,8 @@ namespace AI
             return;
         }
 
+        startTurnStatistics( myColor );
+
         // reset indicator
         Interface::StatusWindow & status = Interface::AdventureMap::Get().getStatusWindow();
         status.DrawAITurnProgress( 0 );
@@ -906,6 +909,8 @@ namespace AI
         }
 
         status.DrawAITurnProgress( 10 );
+
+        finishTurnStatistics();
     }
 
     bool Normal::purchaseNewHeroes( const std::vector<AICastle> & sortedCastleList, const std::set<int> & castlesInDanger, const int32_t availableHeroCount,
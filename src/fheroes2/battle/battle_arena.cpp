@@ -175,20 +175,51 @@ namespace
         return result;
     }
 
+    // Returns the first of the fastest valid units that can still act on this turn, or nullptr if there is no such unit. This is the same unit
+    // that the stable sort of units by speed would put in front, but no temporary containers are allocated as it is called for every action.
+    Battle::Unit * GetFastestUnit( const Battle::Units & units )
+    {
+        Battle::Unit * result = nullptr;
+
+        for ( Battle::Unit * unit : units ) {
+            assert( unit != nullptr );
+
+            if ( !unit->isValid() ) {
+                continue;
+            }
+
+            const uint32_t speed = unit->GetSpeed();
+            if ( speed > Speed::STANDING && ( result == nullptr || speed > result->GetSpeed() ) ) {
+                result = unit;
+            }
+        }
+
+        return result;
+    }
+
     Battle::Unit * GetCurrentUnit( const Battle::Force & army1, const Battle::Force & army2, const int preferredColor )
     {
-        Battle::Units units1( army1.getUnits(), true );
-        Battle::Units units2( army2.getUnits(), true );
+        Battle::Unit * unit1 = GetFastestUnit( army1.getUnits() );
+        Battle::Unit * unit2 = GetFastestUnit( army2.getUnits() );
 
-        units1.SortFastest();
-        units2.SortFastest();
+        Battle::Unit * result = nullptr;
 
-        Battle::Unit * result = GetCurrentUnit( units1, units2, preferredColor != army2.GetColor(), false );
-        if ( result == nullptr ) {
-            return result;
+        if ( unit1 != nullptr && unit2 != nullptr ) {
+            if ( unit1->GetSpeed() == unit2->GetSpeed() ) {
+                result = ( preferredColor != army2.GetColor() ) ? unit1 : unit2;
+            }
+            else {
+                result = ( unit1->GetSpeed() > unit2->GetSpeed() ) ? unit1 : unit2;
+            }
+        }
+        else if ( unit1 != nullptr ) {
+            result = unit1;
+        }
+        else {
+            result = unit2;
         }
 
-        assert( result->isValid() );
+        assert( result == nullptr || result->isValid() );
 
         return result;
     }
@@ -302,8 +333,8 @@ Battle::Arena::Arena( Army & army1, Army & army2, const int32_t tileIndex, const
     assert( arena == nullptr );
     arena = this;
 
-    _army1 = std::make_unique<Force>( army1, false, _randomGenerator, _uidGenerator );
-    _army2 = std::make_unique<Force>( army2, true, _randomGenerator, _uidGenerator );
+    _army1 = std::make_unique<Force>( army1, false, _randomGenerator, _uidGenerator, isShowInterface );
+    _army2 = std::make_unique<Force>( army2, true, _randomGenerator, _uidGenerator, isShowInterface );
 
     // If this is a siege of a town, then there is in fact no castle
     if ( castle && !castle->isCastle() ) {
@@ -1134,7 +1165,7 @@ Battle::Unit * Battle::Arena::CreateElemental( const Spell & spell )
     // An elemental could not be a wide unit
     assert( pos.GetHead() != nullptr && pos.GetTail() == nullptr );
 
-    Unit * elem = new Unit( Troop( mons, count ), pos, reflect, _randomGenerator, _uidGenerator.GetUnique() );
+    Unit * elem = new Unit( Troop( mons, count ), pos, reflect, _randomGenerator, _uidGenerator.GetUnique(), _interface != nullptr );
 
     elem->SetModes( CAP_SUMMONELEM );
     elem->SetArmy( hero->GetArmy() );
@@ -1146,7 +1177,7 @@ Battle::Unit * Battle::Arena::CreateElemental( const Spell & spell )
 
 Battle::Unit * Battle::Arena::CreateMirrorImage( Unit & unit )
 {
-    Unit * mirrorUnit = new Unit( unit, {}, unit.isReflect(), _randomGenerator, _uidGenerator.GetUnique() );
+    Unit * mirrorUnit = new Unit( unit, {}, unit.isReflect(), _randomGenerator, _uidGenerator.GetUnique(), _interface != nullptr );
 
     mirrorUnit->SetArmy( *unit.GetArmy() );
     mirrorUnit->SetMirror( &unit );
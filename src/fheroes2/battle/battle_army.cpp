@@ -104,7 +104,7 @@ Battle::Unit * Battle::Units::FindMode( uint32_t mod ) const
     return it == end() ? nullptr : *it;
 }
 
-Battle::Force::Force( Army & parent, bool opposite, const Rand::DeterministicRandomGenerator & randomGenerator, TroopsUidGenerator & generator )
+Battle::Force::Force( Army & parent, bool opposite, const Rand::DeterministicRandomGenerator & randomGenerator, TroopsUidGenerator & generator, const bool isAnimated )
     : army( parent )
 {
     uids.reserve( army.Size() );
@@ -132,7 +132,7 @@ Battle::Force::Force( Army & parent, bool opposite, const Rand::DeterministicRan
 
         assert( pos.GetHead() != nullptr && ( !troop->isWide() || pos.GetTail() != nullptr ) );
 
-        push_back( new Unit( *troop, pos, opposite, randomGenerator, generator.GetUnique() ) );
+        push_back( new Unit( *troop, pos, opposite, randomGenerator, generator.GetUnique(), isAnimated ) );
         back()->SetArmy( army );
 
         uids.push_back( back()->GetUID() );
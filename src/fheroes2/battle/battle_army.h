@@ -72,7 +72,7 @@ namespace Battle
     class Force : public Units, public BitModes
     {
     public:
-        Force( Army & parent, bool opposite, const Rand::DeterministicRandomGenerator & randomGenerator, TroopsUidGenerator & generator );
+        Force( Army & parent, bool opposite, const Rand::DeterministicRandomGenerator & randomGenerator, TroopsUidGenerator & generator, const bool isAnimated );
         Force( const Force & ) = delete;
 
         ~Force() override;
@@ -2709,13 +2709,27 @@ void Battle::Interface::HumanTurn( const Unit & unit, Actions & actions )
     std::string msg;
     animation_flags_frame = 0;
 
-    // TODO: update delay types within the loop to avoid rendering slowdown.
-    const std::vector<Game::DelayType> delayTypes{ Game::BATTLE_FLAGS_DELAY };
+    // Event handling waits for new events until the earliest of these delays is passed so every animation of this loop must be present here.
+    std::vector<Game::DelayType> delayTypes;
 
     const Board * board = Arena::GetBoard();
     LocalEvent & le = LocalEvent::Get();
 
-    while ( !humanturn_exit && le.HandleEvents( Game::isDelayNeeded( delayTypes ) ) ) {
+    while ( !humanturn_exit ) {
+        delayTypes.clear();
+        delayTypes.push_back( Game::BATTLE_FLAGS_DELAY );
+        delayTypes.push_back( Game::BATTLE_IDLE_DELAY );
+        delayTypes.push_back( Game::BATTLE_SELECTED_UNIT_DELAY );
+
+        // The damage info popup is shown only after this delay is passed. Once passed it stays so until the popup is reset.
+        if ( !Game::hasEveryDelayPassed( { Game::BATTLE_POPUP_DELAY } ) ) {
+            delayTypes.push_back( Game::BATTLE_POPUP_DELAY );
+        }
+
+        if ( !le.HandleEvents( Game::isDelayNeeded( delayTypes ) ) ) {
+            break;
+        }
+
         // move cursor
         int32_t indexNew = -1;
         if ( le.MouseCursor( { _interfacePosition.x, _interfacePosition.y, _interfacePosition.width, _interfacePosition.height - status.height } ) ) {
@@ -3524,7 +3538,7 @@ void Battle::Interface::RedrawActionAttackPart1( Unit & attacker, const Unit & d
     // long distance attack animation
     if ( archer ) {
         // Reset the delay to wait till the next frame if is not already waiting.
-        if ( !Game::isDelayNeeded( { Game::DelayType::CUSTOM_BATTLE_UNIT_MOVEMENT_DELAY } ) ) {
+        if ( Game::hasEveryDelayPassed( { Game::DelayType::CUSTOM_BATTLE_UNIT_MOVEMENT_DELAY } ) ) {
             Game::AnimateResetDelay( Game::DelayType::CUSTOM_BATTLE_UNIT_MOVEMENT_DELAY );
         }
 
@@ -3591,7 +3605,7 @@ void Battle::Interface::RedrawActionAttackPart1( Unit & attacker, const Unit & d
 void Battle::Interface::RedrawActionAttackPart2( Unit & attacker, const Unit & defender, const TargetsInfo & targets, const uint32_t resurrects )
 {
     // Reset the delay to wait till the next frame.
-    if ( !Game::isDelayNeeded( { Game::DelayType::BATTLE_FRAME_DELAY } ) ) {
+    if ( Game::hasEveryDelayPassed( { Game::DelayType::BATTLE_FRAME_DELAY } ) ) {
         Game::AnimateResetDelay( Game::DelayType::BATTLE_FRAME_DELAY );
     }
 
@@ -3674,7 +3688,7 @@ void Battle::Interface::RedrawActionAttackPart2( Unit & attacker, const Unit & d
 void Battle::Interface::RedrawActionWincesKills( const TargetsInfo & targets, Unit * attacker /* = nullptr */, const Unit * defender /* = nullptr */ )
 {
     // Reset the delay to wait till the next frame.
-    if ( !Game::isDelayNeeded( { Game::DelayType::BATTLE_FRAME_DELAY } ) ) {
+    if ( Game::hasEveryDelayPassed( { Game::DelayType::BATTLE_FRAME_DELAY } ) ) {
         Game::AnimateResetDelay( Game::DelayType::BATTLE_FRAME_DELAY );
     }
 
@@ -3879,7 +3893,7 @@ void Battle::Interface::RedrawActionMove( Unit & unit, const Indexes & path )
     }
 
     // Reset the delay to wait till the next frame if is not already waiting.
-    if ( !Game::isDelayNeeded( { Game::DelayType::CUSTOM_BATTLE_UNIT_MOVEMENT_DELAY } ) ) {
+    if ( Game::hasEveryDelayPassed( { Game::DelayType::CUSTOM_BATTLE_UNIT_MOVEMENT_DELAY } ) ) {
         Game::AnimateResetDelay( Game::DelayType::CUSTOM_BATTLE_UNIT_MOVEMENT_DELAY );
     }
 
@@ -4135,7 +4149,7 @@ void Battle::Interface::RedrawActionFly( Unit & unit, const Position & pos )
     }
 
     // Reset the delay to wait till the next frame if is not already waiting.
-    if ( !Game::isDelayNeeded( { Game::DelayType::CUSTOM_BATTLE_UNIT_MOVEMENT_DELAY } ) ) {
+    if ( Game::hasEveryDelayPassed( { Game::DelayType::CUSTOM_BATTLE_UNIT_MOVEMENT_DELAY } ) ) {
         Game::AnimateResetDelay( Game::DelayType::CUSTOM_BATTLE_UNIT_MOVEMENT_DELAY );
     }
 
@@ -4636,7 +4650,7 @@ void Battle::Interface::RedrawActionMonsterSpellCastStatus( const Spell & spell,
 void Battle::Interface::RedrawActionLuck( const Unit & unit )
 {
     // Reset the delay to wait till the next frame if is not already waiting.
-    if ( !Game::isDelayNeeded( { Game::DelayType::BATTLE_MISSILE_DELAY } ) ) {
+    if ( Game::hasEveryDelayPassed( { Game::DelayType::BATTLE_MISSILE_DELAY } ) ) {
         Game::AnimateResetDelay( Game::DelayType::BATTLE_MISSILE_DELAY );
     }
 
@@ -5938,7 +5952,7 @@ void Battle::Interface::RedrawActionRemoveMirrorImage( const std::vector<Unit *>
         return;
 
     // Reset the delay to wait till the next frame if is not already waiting.
-    if ( !Game::isDelayNeeded( { Game::DelayType::BATTLE_FRAME_DELAY } ) ) {
+    if ( Game::hasEveryDelayPassed( { Game::DelayType::BATTLE_FRAME_DELAY } ) ) {
         Game::AnimateResetDelay( Game::DelayType::BATTLE_FRAME_DELAY );
     }
 
@@ -24,13 +24,16 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
 #include <memory>
 #include <ostream>
 #include <set>
 #include <string>
 #include <vector>
 
+#include "agg_image.h"
 #include "ai.h"
+#include "ai_turn_statistics.h"
 #include "army.h"
 #include "army_troop.h"
 #include "artifact.h"
@@ -189,6 +192,8 @@ Battle::Result Battle::Loader( Army & army1, Army & army2, int32_t mapsindex )
         return result;
     }
 
+    const AI::TurnPhaseTimer phaseTimer( AI::TurnPhase::BATTLE );
+
     // pre battle army1
     HeroBase * commander1 = army1.GetCommander();
     uint32_t initialSpellPoints1 = 0;
@@ -240,11 +245,27 @@ Battle::Result Battle::Loader( Army & army1, Army & army2, int32_t mapsindex )
     }
 #endif
 
+    if ( showBattle ) {
+        // Decode monster images while the battlefield is being prepared.
+        std::vector<int> icnIds;
+
+        for ( const Army * army : { &army1, &army2 } ) {
+            for ( size_t i = 0; i < army->Size(); ++i ) {
+                const Troop * troop = army->GetTroop( i );
+                if ( troop != nullptr && troop->isValid() ) {
+                    icnIds.push_back( troop->GetMonsterSprite() );
+                }
+            }
+        }
+
+        fheroes2::AGG::prefetchICNs( icnIds );
+    }
+
     const uint32_t battleSeed = computeBattleSeed( mapsindex, world.GetMapSeed(), army1, army2 );
 
     bool isBattleOver = false;
     while ( !isBattleOver ) {
-        Rand::DeterministicRandomGenerator randomGenerator( battleSeed );
+        Rand::DeterministicRandomGenerator randomGenerator( battleSeed, world.getBattleRandomGeneratorAlgorithm() );
         Arena arena( army1, army2, mapsindex, showBattle, randomGenerator );
 
         DEBUG_LOG( DBG_BATTLE, DBG_INFO, "army1 " << army1.String() )
@@ -367,6 +388,11 @@ Battle::Result Battle::Loader( Army & army1, Army & army2, int32_t mapsindex )
 
     DEBUG_LOG( DBG_BATTLE, DBG_INFO, "army1: " << ( result.army1 & RESULT_WINS ? "wins" : "loss" ) << ", army2: " << ( result.army2 & RESULT_WINS ? "wins" : "loss" ) )
 
+    if ( showBattle ) {
+        // Battle images are not needed anymore and they take a lot of memory.
+        fheroes2::AGG::enforceCacheBudget();
+    }
+
     return result;
 }
 
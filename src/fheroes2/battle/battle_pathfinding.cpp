@@ -24,7 +24,6 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <set>
 #include <tuple>
 #include <type_traits>
 #include <vector>
@@ -42,6 +41,51 @@ namespace
 
 namespace Battle
 {
+    size_t BattlePathfinder::getCacheIndex( const BattleNodeIndex & nodeIdx )
+    {
+        const int32_t headCellIdx = nodeIdx.first;
+        const int32_t tailCellIdx = nodeIdx.second;
+
+        assert( Board::isValidIndex( headCellIdx ) );
+        assert( tailCellIdx == -1 || tailCellIdx == headCellIdx - 1 || tailCellIdx == headCellIdx + 1 );
+
+        const size_t tailOffset = [headCellIdx, tailCellIdx]() -> size_t {
+            if ( tailCellIdx == -1 ) {
+                return 0;
+            }
+
+            return tailCellIdx < headCellIdx ? 1 : 2;
+        }();
+
+        return static_cast<size_t>( headCellIdx ) * _nodesPerCell + tailOffset;
+    }
+
+    const BattleNode * BattlePathfinder::getNode( const BattleNodeIndex & nodeIdx ) const
+    {
+        const size_t cacheIdx = getCacheIndex( nodeIdx );
+
+        if ( _cacheGenerations[cacheIdx] != _currentGeneration ) {
+            return nullptr;
+        }
+
+        return &_cache[cacheIdx];
+    }
+
+    BattleNode & BattlePathfinder::getOrAddNode( const BattleNodeIndex & nodeIdx )
+    {
+        const size_t cacheIdx = getCacheIndex( nodeIdx );
+
+        BattleNode & node = _cache[cacheIdx];
+
+        if ( _cacheGenerations[cacheIdx] != _currentGeneration ) {
+            _cacheGenerations[cacheIdx] = _currentGeneration;
+
+            node = {};
+        }
+
+        return node;
+    }
+
     void BattlePathfinder::reEvaluateIfNeeded( const Unit & unit )
     {
         assert( unit.GetHeadIndex() != -1 && ( !unit.isWide() || unit.GetTailIndex() != -1 ) );
@@ -73,8 +117,15 @@ namespace Battle
         const Castle * castle = Arena::GetCastle();
         const bool isMoatBuilt = castle && castle->isBuild( BUILD_MOAT );
 
-        _cache.clear();
-        _cache.try_emplace( _pathStart );
+        // Invalidate all the nodes at once
+        ++_currentGeneration;
+
+        if ( _currentGeneration == 0 ) {
+            _cacheGenerations.fill( 0 );
+            _currentGeneration = 1;
+        }
+
+        getOrAddNode( _pathStart );
 
         // Flying units can land wherever they can fit
         if ( _isFlying ) {
@@ -99,7 +150,10 @@ namespace Battle
                 // but since the movement takes place, we will consider the distance equal to 1 in this case
                 const uint32_t distance = std::max( Board::GetDistance( unit.GetPosition(), pos ), 1U );
 
-                _cache.try_emplace( newNodeIdx, _pathStart, 1, distance );
+                BattleNode & newNode = getOrAddNode( newNodeIdx );
+                if ( newNode._from == BattleNodeIndex{ -1, -1 } ) {
+                    newNode = { _pathStart, 1, distance };
+                }
             }
 
             return;
@@ -129,14 +183,13 @@ namespace Battle
             return -1;
         }();
 
-        std::vector<BattleNodeIndex> nodesToExplore;
-
-        nodesToExplore.reserve( ARENASIZE * 2 );
-        nodesToExplore.push_back( _pathStart );
+        _nodesToExplore.clear();
+        _nodesToExplore.reserve( ARENASIZE * 2 );
+        _nodesToExplore.push_back( _pathStart );
 
-        for ( size_t nodesToExploreIdx = 0; nodesToExploreIdx < nodesToExplore.size(); ++nodesToExploreIdx ) {
-            const BattleNodeIndex currentNodeIdx = nodesToExplore[nodesToExploreIdx];
-            const BattleNode & currentNode = _cache[currentNodeIdx];
+        for ( size_t nodesToExploreIdx = 0; nodesToExploreIdx < _nodesToExplore.size(); ++nodesToExploreIdx ) {
+            const BattleNodeIndex currentNodeIdx = _nodesToExplore[nodesToExploreIdx];
+            const BattleNode & currentNode = getOrAddNode( currentNodeIdx );
 
             if ( _isWide ) {
                 assert( currentNodeIdx.first != -1 && currentNodeIdx.second != -1 );
@@ -173,13 +226,13 @@ namespace Battle
                     const uint32_t cost = currentNode._cost + ( newNodeIdx == flippedCurrentNodeIdx ? 0 : movementPenalty );
                     const uint32_t distance = currentNode._distance + ( newNodeIdx == flippedCurrentNodeIdx ? 0 : 1 );
 
-                    BattleNode & newNode = _cache[newNodeIdx];
+                    BattleNode & newNode = getOrAddNode( newNodeIdx );
                     if ( newNode._from == BattleNodeIndex{ -1, -1 } || newNode._cost > cost ) {
                         newNode._from = currentNodeIdx;
                         newNode._cost = cost;
                         newNode._distance = distance;
 
-                        nodesToExplore.push_back( newNodeIdx );
+                        _nodesToExplore.push_back( newNodeIdx );
                     }
                 }
             }
@@ -212,13 +265,13 @@ namespace Battle
                     const uint32_t cost = currentNode._cost + movementPenalty;
                     const uint32_t distance = currentNode._distance + 1;
 
-                    BattleNode & newNode = _cache[newNodeIdx];
+                    BattleNode & newNode = getOrAddNode( newNodeIdx );
                     if ( newNode._from == BattleNodeIndex{ -1, -1 } || newNode._cost > cost ) {
                         newNode._from = currentNodeIdx;
                         newNode._cost = cost;
                         newNode._distance = distance;
 
-                        nodesToExplore.push_back( newNodeIdx );
+                        _nodesToExplore.push_back( newNodeIdx );
                     }
                 }
             }
@@ -236,14 +289,12 @@ namespace Battle
 
         const BattleNodeIndex nodeIdx = { position.GetHead()->GetIndex(), position.GetTail() ? position.GetTail()->GetIndex() : -1 };
 
-        const auto iter = _cache.find( nodeIdx );
-        if ( iter == _cache.end() ) {
+        const BattleNode * node = getNode( nodeIdx );
+        if ( node == nullptr ) {
             return false;
         }
 
-        const auto & [index, node] = *iter;
-
-        return ( index == _pathStart || node._from != BattleNodeIndex{ -1, -1 } ) && ( !isOnCurrentTurn || node._cost <= _speed );
+        return ( nodeIdx == _pathStart || node->_from != BattleNodeIndex{ -1, -1 } ) && ( !isOnCurrentTurn || node->_cost <= _speed );
     }
 
     uint32_t BattlePathfinder::getCost( const Unit & unit, const Position & position )
@@ -254,14 +305,12 @@ namespace Battle
 
         const BattleNodeIndex nodeIdx = { position.GetHead()->GetIndex(), position.GetTail() ? position.GetTail()->GetIndex() : -1 };
 
-        const auto iter = _cache.find( nodeIdx );
-        assert( iter != _cache.end() );
-
-        const auto & [index, node] = *iter;
+        const BattleNode * node = getNode( nodeIdx );
+        assert( node != nullptr );
         // MSVC 2017 fails to properly expand the assert() macro without additional parentheses
-        assert( ( index == _pathStart || node._from != BattleNodeIndex{ -1, -1 } ) );
+        assert( ( nodeIdx == _pathStart || node->_from != BattleNodeIndex{ -1, -1 } ) );
 
-        return node._cost;
+        return node->_cost;
     }
 
     uint32_t BattlePathfinder::getDistance( const Unit & unit, const Position & position )
@@ -272,36 +321,40 @@ namespace Battle
 
         const BattleNodeIndex nodeIdx = { position.GetHead()->GetIndex(), position.GetTail() ? position.GetTail()->GetIndex() : -1 };
 
-        const auto iter = _cache.find( nodeIdx );
-        assert( iter != _cache.end() );
-
-        const auto & [index, node] = *iter;
+        const BattleNode * node = getNode( nodeIdx );
+        assert( node != nullptr );
         // MSVC 2017 fails to properly expand the assert() macro without additional parentheses
-        assert( ( index == _pathStart || node._from != BattleNodeIndex{ -1, -1 } ) );
+        assert( ( nodeIdx == _pathStart || node->_from != BattleNodeIndex{ -1, -1 } ) );
 
-        return node._distance;
+        return node->_distance;
     }
 
     Indexes BattlePathfinder::getAllAvailableMoves( const Unit & unit )
     {
         reEvaluateIfNeeded( unit );
 
-        std::set<int32_t> boardIndexes;
+        Indexes result;
+        result.reserve( ARENASIZE );
 
-        for ( const auto & [index, node] : _cache ) {
-            if ( index == _pathStart || node._from == BattleNodeIndex{ -1, -1 } || node._cost > _speed ) {
+        // Nodes are stored in the order of increasing index of the head cell, so the resulting indexes will be sorted
+        for ( size_t cacheIdx = 0; cacheIdx < _cache.size(); ++cacheIdx ) {
+            if ( _cacheGenerations[cacheIdx] != _currentGeneration ) {
                 continue;
             }
 
-            assert( index.first != -1 );
-
-            boardIndexes.insert( index.first );
-        }
+            const BattleNode & node = _cache[cacheIdx];
+            // The starting node is also skipped here
+            if ( node._from == BattleNodeIndex{ -1, -1 } || node._cost > _speed ) {
+                continue;
+            }
 
-        Indexes result;
+            const int32_t headCellIdx = static_cast<int32_t>( cacheIdx / _nodesPerCell );
+            if ( !result.empty() && result.back() == headCellIdx ) {
+                continue;
+            }
 
-        result.reserve( boardIndexes.size() );
-        result.assign( boardIndexes.begin(), boardIndexes.end() );
+            result.push_back( headCellIdx );
+        }
 
         return result;
     }
@@ -320,18 +373,18 @@ namespace Battle
         BattleNodeIndex lastReachableNodeIdx{ -1, -1 };
         BattleNodeIndex nodeIdx = targetNodeIdx;
 
-        for ( auto iter = _cache.find( nodeIdx ); iter != _cache.end(); iter = _cache.find( nodeIdx ) ) {
-            const auto & [index, node] = *iter;
+        for ( const BattleNode * node = getNode( nodeIdx ); node != nullptr; node = getNode( nodeIdx ) ) {
+            const BattleNodeIndex index = nodeIdx;
 
-            if ( index == _pathStart || node._from == BattleNodeIndex{ -1, -1 } ) {
+            if ( index == _pathStart || node->_from == BattleNodeIndex{ -1, -1 } ) {
                 break;
             }
 
-            nodeIdx = node._from;
+            nodeIdx = node->_from;
 
             // A given position may be reachable in principle, but is not reachable on the current turn.
             // Skip the steps that are not reachable on this turn.
-            if ( node._cost > _speed ) {
+            if ( node->_cost > _speed ) {
                 continue;
             }
 
@@ -20,11 +20,12 @@
 
 #pragma once
 
+#include <array>
 #include <bitset>
 #include <cstddef>
 #include <cstdint>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "battle_board.h"
 
@@ -35,19 +36,6 @@ namespace Battle
 
     using BattleNodeIndex = std::pair<int32_t, int32_t>;
 
-    struct BattleNodeIndexHash final
-    {
-        std::size_t operator()( const BattleNodeIndex & index ) const noexcept
-        {
-            const uint64_t f = index.first;
-            const uint64_t s = index.second;
-
-            std::hash<uint64_t> hasher;
-
-            return hasher( ( f << 32 ) + s );
-        }
-    };
-
     struct BattleNode final
     {
         BattleNodeIndex _from{ -1, -1 };
@@ -101,7 +89,26 @@ namespace Battle
         // Rebuilds the graph of available positions for the given unit if necessary (if it is not already cached)
         void reEvaluateIfNeeded( const Unit & unit );
 
-        std::unordered_map<BattleNodeIndex, BattleNode, BattleNodeIndexHash> _cache;
+        // Returns the node with the given index, or nullptr if this node is not in the cache
+        const BattleNode * getNode( const BattleNodeIndex & nodeIdx ) const;
+
+        // Returns the node with the given index, adding it to the cache if necessary
+        BattleNode & getOrAddNode( const BattleNodeIndex & nodeIdx );
+
+        // The head of a narrow unit occupies one cell, and the tail of a wide unit occupies one of the cells adjacent to its head in the same
+        // row, so there are three possible nodes for each cell: without a tail, with a tail on the left and with a tail on the right
+        static constexpr size_t _nodesPerCell{ 3 };
+
+        static size_t getCacheIndex( const BattleNodeIndex & nodeIdx );
+
+        std::array<BattleNode, ARENASIZE * _nodesPerCell> _cache;
+        // A node belongs to the current cache only if its generation matches the current one, so the cache can be cleared without
+        // touching the nodes themselves
+        std::array<uint32_t, ARENASIZE * _nodesPerCell> _cacheGenerations{};
+        uint32_t _currentGeneration{ 0 };
+
+        // Kept here only to avoid memory allocations during the re-evaluation of the cache
+        std::vector<BattleNodeIndex> _nodesToExplore;
 
         // Parameters of the unit for which the current cache is created
         BattleNodeIndex _pathStart{ -1, -1 };
@@ -118,9 +118,10 @@ uint32_t Battle::ModesAffected::FindZeroDuration() const
     return it == end() ? 0 : ( *it ).first;
 }
 
-Battle::Unit::Unit( const Troop & t, const Position & pos, const bool ref, const Rand::DeterministicRandomGenerator & randomGenerator, const uint32_t uid )
+Battle::Unit::Unit( const Troop & t, const Position & pos, const bool ref, const Rand::DeterministicRandomGenerator & randomGenerator, const uint32_t uid,
+                    const bool isAnimated )
     : ArmyTroop( nullptr, t )
-    , animation( id )
+    , animation( isAnimated ? id : Monster::UNKNOWN )
     , _uid( uid )
     , hp( t.GetHitPoints() )
     , _initialCount( t.GetCount() )
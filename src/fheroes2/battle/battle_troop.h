@@ -74,7 +74,9 @@ namespace Battle
     class Unit : public ArmyTroop, public BitModes, public Control
     {
     public:
-        Unit( const Troop & t, const Position & pos, const bool ref, const Rand::DeterministicRandomGenerator & randomGenerator, const uint32_t uid );
+        // Animation sequences are only loaded if 'isAnimated' is true. Units of battles that are resolved without interface never play any animation.
+        Unit( const Troop & t, const Position & pos, const bool ref, const Rand::DeterministicRandomGenerator & randomGenerator, const uint32_t uid,
+              const bool isAnimated );
         Unit( const Unit & ) = delete;
 
         Unit & operator=( const Unit & ) = delete;
@@ -394,6 +394,9 @@ namespace CastleDialog
         CacheBuildings( const Castle &, const fheroes2::Point & );
     };
 
+    // Starts decoding images of the castle dialog in the background.
+    void prefetchImages( const Castle & castle );
+
     void RedrawAllBuilding( const Castle & castle, const fheroes2::Point & dst_pt, const CacheBuildings & orders, const CastleDialog::FadeBuilding & alphaBuilding,
                             const uint32_t animationIndex );
 
@@ -45,6 +45,28 @@ fheroes2::Rect CastleGetMaxArea( const Castle &, const fheroes2::Point & );
 
 namespace
 {
+    int getTownBackgroundIcnId( const int race )
+    {
+        switch ( race ) {
+        case Race::KNGT:
+            return ICN::TOWNBKG0;
+        case Race::BARB:
+            return ICN::TOWNBKG1;
+        case Race::SORC:
+            return ICN::TOWNBKG2;
+        case Race::WRLK:
+            return ICN::TOWNBKG3;
+        case Race::WZRD:
+            return ICN::TOWNBKG4;
+        case Race::NECR:
+            return ICN::TOWNBKG5;
+        default:
+            break;
+        }
+
+        return -1;
+    }
+
     bool isBuildingConnectionNeeded( const Castle & castle, const uint32_t buildId, const bool constructionInProgress )
     {
         const int race = castle.GetRace();
@@ -130,6 +152,21 @@ CastleDialog::CacheBuildings::CacheBuildings( const Castle & castle, const fhero
     }
 }
 
+void CastleDialog::prefetchImages( const Castle & castle )
+{
+    const int race = castle.GetRace();
+
+    std::vector<int> icnIds{ getTownBackgroundIcnId( race ), ICN::STRIP, ICN::CREST, ICN::SMALLBAR };
+
+    for ( const building_t buildingId : fheroes2::getBuildingDrawingPriorities( race, Settings::Get().CurrentFileInfo().version ) ) {
+        if ( castle.isBuild( buildingId ) ) {
+            icnIds.push_back( Castle::GetICNBuilding( buildingId, race ) );
+        }
+    }
+
+    fheroes2::AGG::prefetchICNs( icnIds );
+}
+
 void CastleDialog::FadeBuilding::StartFadeBuilding( const uint32_t build )
 {
     _alpha = 0;
@@ -170,30 +207,7 @@ void CastleRedrawCurrentBuilding( const Castle & castle, const fheroes2::Point &
 {
     fheroes2::Display & display = fheroes2::Display::instance();
 
-    int townIcnId = -1;
-
-    switch ( castle.GetRace() ) {
-    case Race::KNGT:
-        townIcnId = ICN::TOWNBKG0;
-        break;
-    case Race::BARB:
-        townIcnId = ICN::TOWNBKG1;
-        break;
-    case Race::SORC:
-        townIcnId = ICN::TOWNBKG2;
-        break;
-    case Race::WRLK:
-        townIcnId = ICN::TOWNBKG3;
-        break;
-    case Race::WZRD:
-        townIcnId = ICN::TOWNBKG4;
-        break;
-    case Race::NECR:
-        townIcnId = ICN::TOWNBKG5;
-        break;
-    default:
-        break;
-    }
+    const int townIcnId = getTownBackgroundIcnId( castle.GetRace() );
 
     const fheroes2::Rect max = CastleGetMaxArea( castle, dst_pt );
 
@@ -421,28 +435,8 @@ fheroes2::Rect CastleGetMaxArea( const Castle & castle, const fheroes2::Point &
 {
     fheroes2::Rect res( top.x, top.y, 0, 0 );
 
-    int townIcnId = -1;
-
-    switch ( castle.GetRace() ) {
-    case Race::KNGT:
-        townIcnId = ICN::TOWNBKG0;
-        break;
-    case Race::BARB:
-        townIcnId = ICN::TOWNBKG1;
-        break;
-    case Race::SORC:
-        townIcnId = ICN::TOWNBKG2;
-        break;
-    case Race::WRLK:
-        townIcnId = ICN::TOWNBKG3;
-        break;
-    case Race::WZRD:
-        townIcnId = ICN::TOWNBKG4;
-        break;
-    case Race::NECR:
-        townIcnId = ICN::TOWNBKG5;
-        break;
-    default:
+    const int townIcnId = getTownBackgroundIcnId( castle.GetRace() );
+    if ( townIcnId == -1 ) {
         return res;
     }
 
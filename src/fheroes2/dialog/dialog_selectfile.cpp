@@ -261,16 +261,7 @@ namespace
         ListFiles list1;
         list1.ReadDir( Game::GetSaveDir(), Game::GetSaveFileExtension(), false );
 
-        MapsFileInfoList list2( list1.size() );
-        size_t saveFileCount = 0;
-        for ( const std::string & saveFile : list1 ) {
-            if ( list2[saveFileCount].ReadSAV( saveFile ) ) {
-                ++saveFileCount;
-            }
-        }
-        if ( saveFileCount != list2.size() ) {
-            list2.resize( saveFileCount );
-        }
+        MapsFileInfoList list2 = Game::getSaveFileInfoList( list1 );
         std::sort( list2.begin(), list2.end(), Maps::FileInfo::FileSorting );
 
         return list2;
@@ -182,12 +182,27 @@ namespace Interface
 
         bool isCursorOverGamearea = false;
 
-        const std::vector<Game::DelayType> delayTypes = { Game::MAPS_DELAY };
+        bool isScrollPositionActive = false;
+
+        // Event handling waits for new events until the earliest of these delays is passed so only delays of running animations must be present here.
+        std::vector<Game::DelayType> delayTypes;
 
         LocalEvent & le = LocalEvent::Get();
         Cursor & cursor = Cursor::Get();
 
         while ( res == fheroes2::GameMode::CANCEL ) {
+            delayTypes.clear();
+            delayTypes.push_back( Game::MAPS_DELAY );
+
+            // Edge scrolling is done without any new events while the mouse cursor stays still.
+            if ( isScrollPositionActive ) {
+                delayTypes.push_back( Game::SCROLL_START_DELAY );
+            }
+
+            if ( _gameArea.NeedScroll() || _gameArea.needDragScrollRedraw() ) {
+                delayTypes.push_back( Game::SCROLL_DELAY );
+            }
+
             if ( !le.HandleEvents( Game::isDelayNeeded( delayTypes ), true ) ) {
                 if ( EventExit() == fheroes2::GameMode::QUIT_GAME ) {
                     res = fheroes2::GameMode::QUIT_GAME;
@@ -267,6 +282,8 @@ namespace Interface
                 else if ( isScrollBottom( le.GetMouseCursor() ) )
                     scrollPosition |= SCROLL_BOTTOM;
 
+                isScrollPositionActive = ( scrollPosition != SCROLL_NONE );
+
                 if ( scrollPosition != SCROLL_NONE ) {
                     if ( Game::validateAnimationDelay( Game::SCROLL_START_DELAY ) && ( fastScrollRepeatCount < fastScrollStartThreshold ) ) {
                         ++fastScrollRepeatCount;
@@ -281,6 +298,7 @@ namespace Interface
                 }
             }
             else {
+                isScrollPositionActive = false;
                 fastScrollRepeatCount = 0;
             }
 
@@ -521,7 +539,8 @@ namespace Interface
 
     void EditorInterface::mouseCursorAreaClickLeft( const int32_t tileIndex )
     {
-        Maps::Tiles & tile = world.GetTiles( tileIndex );
+        // Tiles must be modified only through references received after an action creation to be properly remembered by the history manager.
+        const Maps::Tiles & tile = world.GetTiles( tileIndex );
 
         Heroes * otherHero = tile.getHero();
         Castle * otherCastle = world.getCastle( tile.GetCenter() );
@@ -555,14 +574,14 @@ namespace Interface
         else if ( _editorPanel.isRoadDraw() ) {
             const fheroes2::ActionCreator action( _historyManager );
 
-            if ( Maps::updateRoadOnTile( tile, true ) ) {
+            if ( Maps::updateRoadOnTile( world.GetTiles( tileIndex ), true ) ) {
                 _redraw |= mapUpdateFlags;
             }
         }
         else if ( _editorPanel.isStreamDraw() ) {
             const fheroes2::ActionCreator action( _historyManager );
 
-            if ( Maps::updateStreamOnTile( tile, true ) ) {
+            if ( Maps::updateStreamOnTile( world.GetTiles( tileIndex ), true ) ) {
                 _redraw |= mapUpdateFlags;
             }
         }
@@ -573,10 +592,12 @@ namespace Interface
             if ( brushSize < 2 ) {
                 const fheroes2::ActionCreator action( _historyManager );
 
-                if ( Maps::updateRoadOnTile( tile, false ) ) {
+                Maps::Tiles & editedTile = world.GetTiles( tileIndex );
+
+                if ( Maps::updateRoadOnTile( editedTile, false ) ) {
                     _redraw |= mapUpdateFlags;
                 }
-                if ( Maps::updateStreamOnTile( tile, false ) ) {
+                if ( Maps::updateStreamOnTile( editedTile, false ) ) {
                     _redraw |= mapUpdateFlags;
                 }
 
@@ -596,16 +617,18 @@ namespace Interface
             else if ( Monster{ _editorPanel.getMonsterId() }.isValid() ) {
                 const fheroes2::ActionCreator action( _historyManager );
 
-                Maps::setMonsterOnTile( tile, _editorPanel.getMonsterId(), 0 );
+                Maps::Tiles & editedTile = world.GetTiles( tileIndex );
+
+                Maps::setMonsterOnTile( editedTile, _editorPanel.getMonsterId(), 0 );
                 // Since setMonsterOnTile() function interprets 0 as a random number of monsters it is important to set the correct value.
-                Maps::setMonsterCountOnTile( tile, 0 );
+                Maps::setMonsterCountOnTile( editedTile, 0 );
 
                 _redraw |= mapUpdateFlags;
             }
             else if ( Monster{ _editorPanel.getMonsterId() }.isRandomMonster() ) {
                 const fheroes2::ActionCreator action( _historyManager );
 
-                Maps::setRandomMonsterOnTile( tile, _editorPanel.getMonsterId() );
+                Maps::setRandomMonsterOnTile( world.GetTiles( tileIndex ), _editorPanel.getMonsterId() );
 
                 _redraw |= mapUpdateFlags;
             }
@@ -22,6 +22,8 @@
 
 #include <cassert>
 #include <cstdint>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "maps_tiles.h"
@@ -30,45 +32,58 @@
 
 namespace
 {
-    class MapAction : public fheroes2::Action
+    // Remembers the original state of every tile accessed for modification while the action is being recorded.
+    // Only the tiles which have been really changed are kept once the recording is finished.
+    class MapAction : public fheroes2::Action, public TileModificationListener
     {
     public:
         MapAction()
             : _latestObjectUIDBefore( Maps::getLastObjectUID() )
         {
-            const int32_t size = world.w() * world.h();
-            _before.reserve( size );
+            world.setTileModificationListener( this );
+        }
+
+        MapAction( const MapAction & ) = delete;
+
+        ~MapAction() override
+        {
+            stopRecording();
+        }
 
-            for ( int32_t i = 0; i < size; ++i ) {
-                _before.push_back( world.GetTiles( i ) );
+        MapAction & operator=( const MapAction & ) = delete;
+
+        void onTileModification( const Maps::Tiles & tile ) override
+        {
+            if ( _recordedTileIds.insert( tile.GetIndex() ).second ) {
+                _before.push_back( tile );
             }
         }
 
         bool prepare()
         {
+            stopRecording();
+
             std::vector<Maps::Tiles> temp;
             std::swap( temp, _before );
 
-            const int32_t size = world.w() * world.h();
-            if ( size != static_cast<int32_t>( temp.size() ) ) {
-                assert( 0 );
-                return false;
-            }
-
             _latestObjectUIDAfter = Maps::getLastObjectUID();
 
             bool foundDifference = false;
 
-            for ( int32_t i = 0; i < size; ++i ) {
-                if ( temp[i] != world.GetTiles( i ) ) {
-                    _before.push_back( std::move( temp[i] ) );
-                    _after.push_back( world.GetTiles( i ) );
+            for ( Maps::Tiles & tile : temp ) {
+                const Maps::Tiles & currentTile = world.GetTiles( tile.GetIndex() );
+                if ( tile != currentTile ) {
+                    _after.push_back( currentTile );
+                    _before.push_back( std::move( tile ) );
                     foundDifference = true;
                 }
             }
 
             assert( _before.size() == _after.size() );
 
+            // Recorded tile IDs are not needed anymore.
+            std::unordered_set<int32_t>().swap( _recordedTileIds );
+
             // TODO: logically if the last object UID has been changed then we should mark the difference.
 
             return foundDifference;
@@ -107,9 +122,21 @@ namespace
         }
 
     private:
+        void stopRecording()
+        {
+            if ( _isRecording ) {
+                world.setTileModificationListener( nullptr );
+                _isRecording = false;
+            }
+        }
+
         std::vector<Maps::Tiles> _before;
         std::vector<Maps::Tiles> _after;
 
+        std::unordered_set<int32_t> _recordedTileIds;
+
+        bool _isRecording{ true };
+
         const uint32_t _latestObjectUIDBefore{ 0 };
         uint32_t _latestObjectUIDAfter{ 0 };
     };
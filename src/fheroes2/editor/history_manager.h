@@ -41,7 +41,8 @@ namespace fheroes2
         virtual bool undo() = 0;
     };
 
-    // Remember the map state and create an action if the map has changed.
+    // Remember the original state of tiles modified while this object exists and create an action if the map has changed.
+    // Tiles must be modified only through references received from World::GetTiles() after this object creation.
     class ActionCreator
     {
     public:
@@ -49,6 +49,7 @@
 #include "embedded_image.h"
 #include "exception.h"
 #include "game.h"
+#include "game_io.h"
 #include "game_logo.h"
 #include "game_video.h"
 #include "game_video_type.h"
@@ -241,7 +242,11 @@ namespace
 
         DataInitializer( const DataInitializer & ) = delete;
         DataInitializer & operator=( const DataInitializer & ) = delete;
-        ~DataInitializer() = default;
+
+        ~DataInitializer()
+        {
+            fheroes2::AGG::stopPrefetching();
+        }
 
         const std::string & getOriginalAGGFilePath() const
         {
@@ -257,6 +262,20 @@ namespace
         std::unique_ptr<AGG::AGGInitializer> _aggInitializer;
         std::unique_ptr<fheroes2::h2d::H2DInitializer> _h2dInitializer;
     };
+
+    // Autosaves are written in the background so the last one has to be completed before the application exits.
+    class AutoSaveFinalizer
+    {
+    public:
+        AutoSaveFinalizer() = default;
+        AutoSaveFinalizer( const AutoSaveFinalizer & ) = delete;
+        AutoSaveFinalizer & operator=( const AutoSaveFinalizer & ) = delete;
+
+        ~AutoSaveFinalizer()
+        {
+            Game::finishAutoSave();
+        }
+    };
 }
 
 int main( int argc, char ** argv )
@@ -266,8 +285,6 @@ int main( int argc, char ** argv )
     assert( argc == __argc );
 
     argv = __argv;
-#else
-    (void)argc;
 #endif
 
     try {
@@ -279,6 +296,10 @@ int main( int argc, char ** argv )
         Settings & conf = Settings::Get();
         conf.SetProgramPath( argv[0] );
 
+        if ( !Game::parseAIBenchmarkArguments( argc, argv ) ) {
+            return EXIT_FAILURE;
+        }
+
         InitConfigDir();
         InitDataDir();
         ReadConfigs();
@@ -296,6 +317,7 @@ int main( int argc, char ** argv )
 
         const DisplayInitializer displayInitializer;
         const DataInitializer dataInitializer;
+        const AutoSaveFinalizer autoSaveFinalizer;
 
         ListFiles midiSoundFonts;
 
@@ -311,7 +333,8 @@ int main( int argc, char ** argv )
         const AudioManager::AudioInitializer audioInitializer( dataInitializer.getOriginalAGGFilePath(), dataInitializer.getExpansionAGGFilePath(), midiSoundFonts );
 
         // Load palette.
-        fheroes2::setGamePalette( AGG::getDataFromAggFile( "KB.PAL" ) );
+        const fheroes2::AGGFileData palette = AGG::getDataFromAggFile( "KB.PAL" );
+        fheroes2::setGamePalette( std::vector<uint8_t>( palette.begin(), palette.end() ) );
         fheroes2::Display::instance().changePalette( nullptr, true );
 
         // load BIN data
@@ -322,7 +345,7 @@ int main( int argc, char ** argv )
 
         conf.setGameLanguage( conf.getGameLanguage() );
 
-        if ( conf.isShowIntro() ) {
+        if ( conf.isShowIntro() && !Game::isAIBenchmark() ) {
             fheroes2::showTeamInfo();
 
             Video::ShowVideo( "NWCLOGO.SMK", Video::VideoAction::PLAY_TILL_VIDEO_END );
@@ -333,7 +356,14 @@ int main( int argc, char ** argv )
         try {
             const CursorRestorer cursorRestorer( true, Cursor::POINTER );
 
-            Game::mainGameLoop( conf.isFirstGameRun() );
+            if ( Game::isAIBenchmark() ) {
+                if ( !Game::runAIBenchmark() ) {
+                    return EXIT_FAILURE;
+                }
+            }
+            else {
+                Game::mainGameLoop( conf.isFirstGameRun() );
+            }
         }
         catch ( const fheroes2::InvalidDataResources & ex ) {
             ERROR_LOG( ex.what() )
@@ -80,6 +80,16 @@ namespace Game
     fheroes2::GameMode CompleteCampaignScenario( const bool isLoadingSaveFile );
     fheroes2::GameMode DisplayHighScores( const bool isCampaign );
 
+    // An AI benchmark is an all-AI game on the given map which is started from the command line instead of the main menu:
+    //   fheroes2 --ai-benchmark <map file> [--seed <number>] [--days <number>]
+    // Returns false if the command line has invalid arguments. Returns true if there is no AI benchmark in the command line.
+    bool parseAIBenchmarkArguments( const int argc, const char * const * argv );
+    bool isAIBenchmark();
+    // Returns true if the AI benchmark game has played all its days.
+    bool isAIBenchmarkDayLimitReached();
+    // Runs the AI benchmark game. Returns false if the map cannot be loaded.
+    bool runAIBenchmark();
+
     bool isSuccessionWarsCampaignPresent();
     bool isPriceOfLoyaltyCampaignPresent();
 
@@ -0,0 +1,161 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "game.h"
+#include "game_mode.h"
+#include "logging.h"
+#include "maps_fileinfo.h"
+#include "players.h"
+#include "rand.h"
+#include "settings.h"
+#include "world.h"
+
+namespace
+{
+    struct AIBenchmarkParameters
+    {
+        bool isEnabled{ false };
+        std::string mapFile;
+        uint32_t seed{ 0 };
+        // Four weeks by default.
+        uint32_t days{ 28 };
+    };
+
+    AIBenchmarkParameters aiBenchmark;
+
+    bool parseNumber( const char * text, uint32_t & value )
+    {
+        const char * last = text + std::strlen( text );
+
+        const auto [ptr, ec] = std::from_chars( text, last, value );
+
+        return ec == std::errc() && ptr == last;
+    }
+}
+
+bool Game::parseAIBenchmarkArguments( const int argc, const char * const * argv )
+{
+    AIBenchmarkParameters parameters;
+    bool isSeedSet = false;
+    bool isDayLimitSet = false;
+
+    for ( int i = 1; i < argc; ++i ) {
+        const std::string argument = argv[i];
+
+        // Some platforms pass their own arguments to the application.
+        if ( argument != "--ai-benchmark" && argument != "--seed" && argument != "--days" ) {
+            DEBUG_LOG( DBG_GAME, DBG_WARN, "Unknown command line argument " << argument )
+            continue;
+        }
+
+        if ( i + 1 == argc ) {
+            ERROR_LOG( "No value is given for the command line argument " << argument )
+            return false;
+        }
+
+        const char * value = argv[++i];
+
+        if ( argument == "--ai-benchmark" ) {
+            parameters.isEnabled = true;
+            parameters.mapFile = value;
+        }
+        else if ( argument == "--seed" ) {
+            if ( !parseNumber( value, parameters.seed ) ) {
+                ERROR_LOG( "Invalid seed " << value )
+                return false;
+            }
+
+            isSeedSet = true;
+        }
+        else {
+            if ( !parseNumber( value, parameters.days ) || parameters.days == 0 ) {
+                ERROR_LOG( "Invalid number of days " << value )
+                return false;
+            }
+
+            isDayLimitSet = true;
+        }
+    }
+
+    if ( !parameters.isEnabled && ( isSeedSet || isDayLimitSet ) ) {
+        ERROR_LOG( "The seed and the number of days can be set only for an AI benchmark" )
+        return false;
+    }
+
+    aiBenchmark = std::move( parameters );
+
+    return true;
+}
+
+bool Game::isAIBenchmark()
+{
+    return aiBenchmark.isEnabled;
+}
+
+bool Game::isAIBenchmarkDayLimitReached()
+{
+    return aiBenchmark.isEnabled && world.CountDay() >= aiBenchmark.days;
+}
+
+bool Game::runAIBenchmark()
+{
+    Maps::FileInfo mapInfo;
+    if ( !mapInfo.ReadMP2( aiBenchmark.mapFile ) ) {
+        ERROR_LOG( "Failed to read the map file " << aiBenchmark.mapFile )
+        return false;
+    }
+
+    // Every random value of the game comes from the generator of the main thread starting from the map generation,
+    // so the same build plays the same game for the same seed.
+    Rand::CurrentThreadRandomDevice().seed( aiBenchmark.seed );
+
+    Settings & conf = Settings::Get();
+
+    conf.SetGameType( Game::TYPE_STANDARD );
+    conf.SetCurrentFileInfo( mapInfo );
+
+    for ( Player * player : conf.GetPlayers() ) {
+        player->SetControl( CONTROL_AI );
+    }
+
+    // AI turns are measured without rendering of AI hero movements.
+    conf.SetAIMoveSpeed( 0 );
+    conf.setAITurnStatistics( true );
+
+    conf.GetPlayers().SetStartGame();
+
+    if ( !world.LoadMapMP2( mapInfo.file, mapInfo.version == GameVersion::SUCCESSION_WARS ) ) {
+        ERROR_LOG( "Failed to load the map " << mapInfo.file )
+        return false;
+    }
+
+    COUT( "AI benchmark: map " << mapInfo.file << ", seed " << aiBenchmark.seed << ", days " << aiBenchmark.days )
+
+    StartGame();
+
+    return true;
+}
@@ -23,10 +23,13 @@
 
 #include "game_delays.h"
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 #include <memory>
 
 #include "gamedefs.h"
+#include "localevent.h"
 #include "settings.h"
 #include "timing.h"
 
@@ -233,12 +236,21 @@ bool Game::hasEveryDelayPassed( const std::vector<Game::DelayType> & delayTypes
 
 bool Game::isDelayNeeded( const std::vector<Game::DelayType> & delayTypes )
 {
+    uint64_t waitTime = std::numeric_limits<uint64_t>::max();
+
     for ( const Game::DelayType type : delayTypes ) {
         assert( type != Game::DelayType::CUSTOM_DELAY );
 
-        if ( delays[type].isPassed() ) {
+        const uint64_t remainingTime = delays[type].getRemainingMs();
+        if ( remainingTime == 0 ) {
             return false;
         }
+
+        waitTime = std::min( waitTime, remainingTime );
+    }
+
+    if ( !delayTypes.empty() ) {
+        LocalEvent::Get().setIdleWaitTime( waitTime );
     }
 
     return true;
@@ -246,7 +258,14 @@ bool Game::isDelayNeeded( const std::vector<Game::DelayType> & delayTypes )
 
 bool Game::isCustomDelayNeeded( const uint64_t delayMs )
 {
-    return !delays[Game::DelayType::CUSTOM_DELAY].isPassed( delayMs );
+    const uint64_t remainingTime = delays[Game::DelayType::CUSTOM_DELAY].getRemainingMs( delayMs );
+    if ( remainingTime == 0 ) {
+        return false;
+    }
+
+    LocalEvent::Get().setIdleWaitTime( remainingTime );
+
+    return true;
 }
 
 uint64_t Game::getAnimationDelayValue( const DelayType delayType )
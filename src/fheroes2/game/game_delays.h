@@ -93,8 +93,11 @@ namespace Game
     bool hasEveryDelayPassed( const std::vector<Game::DelayType> & delayTypes );
 
     // Returns true if every of delay type is not passed yet. DelayType::CUSTOM_DELAY must not be added in this function!
+    // In this case the next event handling is allowed to wait for new events until the earliest delay is passed,
+    // so use hasEveryDelayPassed() for checks which are not followed by LocalEvent::HandleEvents() call.
     bool isDelayNeeded( const std::vector<Game::DelayType> & delayTypes );
 
+    // Returns true if custom delay is not passed yet. In this case the next event handling is allowed to wait for new events until it is passed.
     bool isCustomDelayNeeded( const uint64_t delayMs );
 
     // Custom delay must never be called in this function.
@@ -127,7 +127,17 @@ void Interface::AdventureMap::redraw( const uint32_t force )
     const uint32_t combinedRedraw = _redraw | force;
     const bool hideInterface = conf.isHideInterfaceEnabled();
 
-    if ( combinedRedraw & REDRAW_GAMEAREA ) {
+    if ( combinedRedraw == REDRAW_GAMEAREA_ANIMATION && !hideInterface ) {
+        // Only animated objects have been changed so there is no need to redraw and render everything.
+        addGameAreaAnimationRenderRoi( _gameArea.redrawAnimatedObjects( fheroes2::Display::instance(), LEVEL_ALL ) );
+
+        _redraw = 0;
+        return;
+    }
+
+    setFullRender();
+
+    if ( combinedRedraw & ( REDRAW_GAMEAREA | REDRAW_GAMEAREA_ANIMATION ) ) {
         _gameArea.Redraw( fheroes2::Display::instance(), LEVEL_ALL );
 
         if ( hideInterface && conf.ShowControlPanel() ) {
@@ -25,14 +25,21 @@
 
 #include <algorithm>
 #include <cctype>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <ostream>
 #include <utility>
 
 #include "campaign_savedata.h"
 #include "campaign_scenariodata.h"
 #include "dialog.h"
+#include "dir.h"
+#include "file_index.h"
 #include "game.h"
 #include "game_over.h"
 #include "logging.h"
@@ -41,6 +48,7 @@
 #include "serialize.h"
 #include "settings.h"
 #include "system.h"
+#include "thread.h"
 #include "translations.h"
 #include "ui_dialog.h"
 #include "ui_language.h"
@@ -53,10 +61,15 @@ namespace
 
     const uint16_t SAV2ID3 = 0xFF03;
 
-    uint16_t versionOfCurrentSaveFile = CURRENT_FORMAT_VERSION;
+    // Each thread has its own version so that headers of several save files can be read at the same time.
+    thread_local uint16_t versionOfCurrentSaveFile = CURRENT_FORMAT_VERSION;
 
     std::string lastSaveName;
 
+    // The size of the game data changes little from one autosave to another, so the size of the previous one (with some margin)
+    // is used to allocate the buffer for the next one at once.
+    size_t autoSaveDataSizeHint = 0;
+
     struct HeaderSAV
     {
         enum
@@ -101,18 +114,224 @@ namespace
     {
         return msg >> hdr.status >> hdr.info >> hdr.gameType;
     }
+
+    // Headers of the save files are stored on the disk so only new or modified save files have to be opened when the list of save files
+    // is requested.
+    const uint32_t saveFileIndexMagic = 0x53415649;
+    const uint16_t saveFileIndexVersion = 1;
+
+    using SaveFileIndex = fheroes2::FileIndex<HeaderSAV>;
+
+    bool readSaveFileHeader( const std::string & filePath, HeaderSAV & header )
+    {
+        StreamFile fs;
+        fs.setbigendian( true );
+
+        if ( !fs.open( filePath, "rb" ) ) {
+            DEBUG_LOG( DBG_GAME, DBG_WARN, "Error opening the file " << filePath )
+            return false;
+        }
+
+        uint16_t savId = 0;
+        fs >> savId;
+
+        if ( savId != SAV2ID3 ) {
+            DEBUG_LOG( DBG_GAME, DBG_WARN, "Invalid SAV2ID in the file " << filePath )
+            return false;
+        }
+
+        std::string saveFileVersionStr;
+        uint16_t saveFileVersion = 0;
+
+        fs >> saveFileVersionStr >> saveFileVersion;
+
+        DEBUG_LOG( DBG_GAME, DBG_TRACE, "Version of the file " << filePath << ": " << saveFileVersion )
+
+        if ( saveFileVersion > CURRENT_FORMAT_VERSION || saveFileVersion < LAST_SUPPORTED_FORMAT_VERSION ) {
+            return false;
+        }
+
+        const Game::SaveFileVersionRestorer versionRestorer( saveFileVersion );
+
+        fs >> header;
+
+        return true;
+    }
+
+    void writeSaveHeader( StreamBase & stream )
+    {
+        const Settings & conf = Settings::Get();
+
+        // Always use the latest version of the file save format
+        Game::SetVersionOfCurrentSaveFile( CURRENT_FORMAT_VERSION );
+        const uint16_t saveFileVersion = CURRENT_FORMAT_VERSION;
+
+        stream << SAV2ID3 << std::to_string( saveFileVersion ) << saveFileVersion
+               << HeaderSAV( conf.CurrentFileInfo(), conf.GameType(), world.GetDay(), world.GetWeek(), world.GetMonth() );
+    }
+
+    void writeSaveData( StreamBase & stream )
+    {
+        stream << World::Get() << Settings::Get() << GameOver::Result::Get();
+
+        if ( Settings::Get().isCampaignGameType() ) {
+            stream << Campaign::CampaignSaveData::Get();
+        }
+
+        // End-of-data marker
+        stream << SAV2ID3;
+    }
+
+    // Writes the header and the compressed game data to the file. Returns true on success.
+    bool writeSaveFile( const std::string & filePath, const StreamBuf & header, const StreamBuf & data, const int compressionLevel )
+    {
+        StreamFile fs;
+
+        if ( !fs.open( filePath, "wb" ) ) {
+            return false;
+        }
+
+        fs.putRaw( reinterpret_cast<const char *>( header.data() ), header.size() );
+        fs.close();
+
+        ZStreamFile zb;
+
+        if ( !zb.open( filePath, true, compressionLevel ) ) {
+            return false;
+        }
+
+        zb.putRaw( reinterpret_cast<const char *>( data.data() ), data.size() );
+
+        return zb.close();
+    }
+
+    // Autosaves are written in the background. The game state is serialized on the main thread, which is quick since no compression
+    // is involved, and the worker thread compresses it and writes it to a temporary file which then replaces the previous autosave.
+    // This way the autosave file is never left incomplete even if the game is closed or crashes while it is being written.
+    class AutoSaveManager final : public MultiThreading::AsyncManager
+    {
+    public:
+        void pushSave( std::string filePath, StreamBuf header, StreamBuf data )
+        {
+            createWorker();
+
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
+            // If the previous autosave has not been started yet, it is outdated anyway.
+            _pendingSave = SaveTask{ std::move( filePath ), std::move( header ), std::move( data ) };
+
+            notifyWorker();
+        }
+
+        void waitForCompletion()
+        {
+            std::unique_lock<std::mutex> lock( _mutex );
+
+            _saveFinished.wait( lock, [this] { return !_pendingSave && !_currentSave; } );
+        }
+
+    private:
+        struct SaveTask
+        {
+            std::string filePath;
+            StreamBuf header;
+            StreamBuf data;
+        };
+
+        std::optional<SaveTask> _pendingSave;
+
+        // The autosave being written by the worker thread. It can be modified only when _mutex is acquired.
+        std::optional<SaveTask> _currentSave;
+
+        std::condition_variable _saveFinished;
+
+        // This method is called by the worker thread and is protected by _mutex
+        bool prepareTask() override
+        {
+            if ( !_pendingSave ) {
+                return false;
+            }
+
+            _currentSave = std::move( _pendingSave );
+            _pendingSave.reset();
+
+            return true;
+        }
+
+        // This method is called by the worker thread, but is not protected by _mutex
+        void executeTask() override
+        {
+            if ( !_currentSave ) {
+                return;
+            }
+
+            const std::string & filePath = _currentSave->filePath;
+            const std::string tempFilePath = filePath + ".tmp";
+
+            if ( !writeSaveFile( tempFilePath, _currentSave->header, _currentSave->data, ZStreamFile::FASTEST_COMPRESSION_LEVEL ) ) {
+                ERROR_LOG( "Failed to write the autosave file " << tempFilePath )
+
+                // The file is incomplete.
+                System::Unlink( tempFilePath );
+            }
+            else if ( !System::ReplaceFile( tempFilePath, filePath ) ) {
+                // The previous autosave is kept as is. The complete new autosave is kept in the temporary file so it is not lost.
+                ERROR_LOG( "Failed to replace the autosave file " << filePath << " by " << tempFilePath )
+            }
+
+            {
+                const std::scoped_lock<std::mutex> lock( _mutex );
+
+                _currentSave.reset();
+            }
+
+            _saveFinished.notify_all();
+        }
+    };
+
+    AutoSaveManager autoSaveManager;
 }
 
 bool Game::AutoSave()
 {
-    return Game::Save( System::concatPath( GetSaveDir(), autoSaveName + GetSaveFileExtension() ), true );
+    const std::string filePath = System::concatPath( GetSaveDir(), autoSaveName + GetSaveFileExtension() );
+
+    DEBUG_LOG( DBG_GAME, DBG_INFO, filePath )
+
+    StreamBuf header;
+    header.setbigendian( true );
+
+    writeSaveHeader( header );
+
+    StreamBuf data;
+    data.setbigendian( true );
+    data.reserve( autoSaveDataSizeHint );
+
+    writeSaveData( data );
+
+    if ( header.fail() || data.fail() ) {
+        return false;
+    }
+
+    autoSaveDataSizeHint = data.size() + data.size() / 8;
+
+    autoSaveManager.pushSave( filePath, std::move( header ), std::move( data ) );
+
+    return true;
 }
 
-bool Game::Save( const std::string & filePath, const bool autoSave /* = false */ )
+void Game::finishAutoSave()
+{
+    autoSaveManager.waitForCompletion();
+    autoSaveManager.stopWorker();
+}
+
+bool Game::Save( const std::string & filePath )
 {
     DEBUG_LOG( DBG_GAME, DBG_INFO, filePath )
 
-    const Settings & conf = Settings::Get();
+    // Do not let the autosave being written in the background compete for the same file or for the disk.
+    autoSaveManager.waitForCompletion();
 
     StreamFile fs;
     fs.setbigendian( true );
@@ -122,35 +341,27 @@ bool Game::Save( const std::string & filePath, const bool autoSave /* = false */
         return false;
     }
 
-    // Always use the latest version of the file save format
-    SetVersionOfCurrentSaveFile( CURRENT_FORMAT_VERSION );
-    uint16_t saveFileVersion = CURRENT_FORMAT_VERSION;
-
     // Header
-    fs << SAV2ID3 << std::to_string( saveFileVersion ) << saveFileVersion
-       << HeaderSAV( conf.CurrentFileInfo(), conf.GameType(), world.GetDay(), world.GetWeek(), world.GetMonth() );
+    writeSaveHeader( fs );
     fs.close();
 
-    ZStreamBuf zb;
+    // Game data in ZIP format. It is compressed and written to the file while being serialized, so that the whole save is never kept
+    // in memory.
+    ZStreamFile zb;
     zb.setbigendian( true );
 
-    // Game data in ZIP format
-    zb << World::Get() << Settings::Get() << GameOver::Result::Get();
-
-    if ( conf.isCampaignGameType() ) {
-        zb << Campaign::CampaignSaveData::Get();
+    if ( !zb.open( filePath, true, ZStreamFile::DEFAULT_COMPRESSION_LEVEL ) ) {
+        DEBUG_LOG( DBG_GAME, DBG_WARN, "Error opening the file " << filePath )
+        return false;
     }
 
-    // End-of-data marker
-    zb << SAV2ID3;
+    writeSaveData( zb );
 
-    if ( zb.fail() || !zb.write( filePath, true ) ) {
+    if ( !zb.close() ) {
         return false;
     }
 
-    if ( !autoSave ) {
-        Game::SetLastSaveName( filePath );
-    }
+    Game::SetLastSaveName( filePath );
 
     return true;
 }
@@ -159,6 +370,8 @@ fheroes2::GameMode Game::Load( const std::string & filePath )
 {
     DEBUG_LOG( DBG_GAME, DBG_INFO, filePath )
 
+    autoSaveManager.waitForCompletion();
+
     const auto showGenericErrorMessage = []() { fheroes2::showStandardTextMessage( _( "Error" ), _( "The save file is corrupted." ), Dialog::OK ); };
 
     StreamFile fs;
@@ -299,50 +512,98 @@ fheroes2::GameMode Game::Load( const std::string & filePath )
     return returnValue;
 }
 
-bool Game::LoadSAV2FileInfo( std::string filePath, Maps::FileInfo & fileInfo )
+std::vector<Maps::FileInfo> Game::getSaveFileInfoList( const ListFiles & saveFiles )
 {
-    DEBUG_LOG( DBG_GAME, DBG_INFO, filePath )
+    autoSaveManager.waitForCompletion();
 
-    StreamFile fs;
-    fs.setbigendian( true );
+    const std::string indexPath = GetFileIndexPath( "saves.idx" );
 
-    if ( !fs.open( filePath, "rb" ) ) {
-        DEBUG_LOG( DBG_GAME, DBG_WARN, "Error opening the file " << filePath )
-        return false;
+    SaveFileIndex previousIndex;
+    if ( !indexPath.empty() ) {
+        const SaveFileVersionRestorer versionRestorer( CURRENT_FORMAT_VERSION );
+        previousIndex = fheroes2::loadFileIndex<HeaderSAV>( indexPath, saveFileIndexMagic, saveFileIndexVersion, CURRENT_FORMAT_VERSION );
     }
 
-    uint16_t savId = 0;
-    fs >> savId;
+    SaveFileIndex index;
 
-    if ( savId != SAV2ID3 ) {
-        DEBUG_LOG( DBG_GAME, DBG_WARN, "Invalid SAV2ID in the file " << filePath )
-        return false;
+    const int gameType = Settings::Get().GameType();
+
+    // Headers of new and modified save files are read in parallel after the whole list is checked against the previous index.
+    std::vector<std::pair<const std::string *, fheroes2::FileIndexEntry<HeaderSAV> *>> changedEntries;
+
+    for ( const std::string & saveFile : saveFiles ) {
+        fheroes2::FileIndexEntry<HeaderSAV> entry;
+
+        if ( !System::GetFileSizeAndModificationTime( saveFile, entry.fileSize, entry.modificationTime ) ) {
+            continue;
+        }
+
+        const auto previousEntry = previousIndex.find( saveFile );
+        const bool isUnchanged = previousEntry != previousIndex.end() && previousEntry->second.fileSize == entry.fileSize
+                                 && previousEntry->second.modificationTime == entry.modificationTime;
+        if ( isUnchanged ) {
+            entry = std::move( previousEntry->second );
+            previousIndex.erase( previousEntry );
+        }
+
+        const auto [iter, isInserted] = index.try_emplace( saveFile, std::move( entry ) );
+        if ( isInserted && !isUnchanged ) {
+            changedEntries.emplace_back( &iter->first, &iter->second );
+        }
     }
 
-    std::string saveFileVersionStr;
-    uint16_t saveFileVersion = 0;
+    MultiThreading::runParallelTasks( changedEntries.size(), [&changedEntries]( const size_t id ) {
+        const auto & [saveFile, entry] = changedEntries[id];
 
-    fs >> saveFileVersionStr >> saveFileVersion;
+        DEBUG_LOG( DBG_GAME, DBG_INFO, *saveFile )
 
-    DEBUG_LOG( DBG_GAME, DBG_TRACE, "Version of the file " << filePath << ": " << saveFileVersion )
+        entry->isValid = readSaveFileHeader( *saveFile, entry->payload );
+    } );
 
-    if ( saveFileVersion > CURRENT_FORMAT_VERSION || saveFileVersion < LAST_SUPPORTED_FORMAT_VERSION ) {
-        return false;
+    bool isIndexChanged = !changedEntries.empty();
+
+    std::vector<Maps::FileInfo> result;
+    result.reserve( index.size() );
+
+    for ( const std::string & saveFile : saveFiles ) {
+        const auto entry = index.find( saveFile );
+        if ( entry == index.end() || !entry->second.isValid || ( gameType & entry->second.payload.gameType ) == 0 ) {
+            continue;
+        }
+
+        Maps::FileInfo & fileInfo = result.emplace_back( entry->second.payload.info );
+        fileInfo.file = saveFile;
     }
 
-    SetVersionOfCurrentSaveFile( saveFileVersion );
+    // The list contains the save files of one game type only so the entries of other save files are kept as long as these files exist.
+    for ( auto & [saveFile, entry] : previousIndex ) {
+        if ( index.count( saveFile ) > 0 ) {
+            continue;
+        }
 
-    HeaderSAV header;
-    fs >> header;
+        if ( System::IsFile( saveFile ) ) {
+            index.try_emplace( saveFile, std::move( entry ) );
+        }
+        else {
+            isIndexChanged = true;
+        }
+    }
 
-    if ( ( Settings::Get().GameType() & header.gameType ) == 0 ) {
-        return false;
+    if ( !indexPath.empty() && isIndexChanged ) {
+        fheroes2::saveFileIndex( indexPath, saveFileIndexMagic, saveFileIndexVersion, CURRENT_FORMAT_VERSION, index );
     }
 
-    fileInfo = std::move( header.info );
-    fileInfo.file = std::move( filePath );
+    return result;
+}
 
-    return true;
+std::string Game::GetFileIndexPath( const std::string & indexFileName )
+{
+    const std::string dataDir = System::GetDataDirectory( "fheroes2" );
+    if ( dataDir.empty() ) {
+        return {};
+    }
+
+    return System::concatPath( System::concatPath( dataDir, "files" ), indexFileName );
 }
 
 void Game::SetVersionOfCurrentSaveFile( const uint16_t version )
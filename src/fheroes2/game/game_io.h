@@ -26,9 +26,12 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "game_mode.h"
 
+struct ListFiles;
+
 namespace Maps
 {
     struct FileInfo;
@@ -42,18 +45,52 @@ namespace Game
     uint16_t GetVersionOfCurrentSaveFile();
     void SetVersionOfCurrentSaveFile( const uint16_t version );
 
+    // Sets the version of the current save file while the object exists. Use it to read data stored in the save file format outside of save files.
+    class SaveFileVersionRestorer
+    {
+    public:
+        explicit SaveFileVersionRestorer( const uint16_t version )
+            : _previousVersion( GetVersionOfCurrentSaveFile() )
+        {
+            SetVersionOfCurrentSaveFile( version );
+        }
+
+        SaveFileVersionRestorer( const SaveFileVersionRestorer & ) = delete;
+
+        ~SaveFileVersionRestorer()
+        {
+            SetVersionOfCurrentSaveFile( _previousVersion );
+        }
+
+        SaveFileVersionRestorer & operator=( const SaveFileVersionRestorer & ) = delete;
+
+    private:
+        const uint16_t _previousVersion;
+    };
+
+    // Returns the path of the given file index in the game data directory or an empty string if this directory is not available.
+    // Indices are written in the current save file format. See fheroes2::loadFileIndex() function.
+    std::string GetFileIndexPath( const std::string & indexFileName );
+
     std::string GetSaveDir();
     std::string GetSaveFileBaseName();
     std::string GetSaveFileExtension();
     std::string GetSaveFileExtension( const int gameType );
 
+    // Serializes the game and writes the autosave file in the background.
     bool AutoSave();
-    bool Save( const std::string & filePath, const bool autoSave = false );
+
+    // Waits until the autosave being written in the background is complete. Must be called before the application exits.
+    void finishAutoSave();
+
+    bool Save( const std::string & filePath );
 
     // Returns GameMode::CANCEL in case of failure.
     fheroes2::GameMode Load( const std::string & filePath );
 
-    bool LoadSAV2FileInfo( std::string filePath, Maps::FileInfo & fileInfo );
+    // Returns the information about the given save files which match the current game type. Only new or modified save files are opened,
+    // the headers of other save files are taken from the index kept on the disk.
+    std::vector<Maps::FileInfo> getSaveFileInfoList( const ListFiles & saveFiles );
 
     bool SaveCompletedCampaignScenario();
 }
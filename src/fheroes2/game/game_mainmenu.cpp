@@ -103,6 +103,9 @@ void Game::mainGameLoop( bool isFirstGameRun )
     bool exit = false;
 
     while ( !exit ) {
+        // All images of the previous game mode are not in use anymore.
+        fheroes2::AGG::enforceCacheBudget();
+
         switch ( result ) {
         case fheroes2::GameMode::QUIT_GAME:
             exit = true;
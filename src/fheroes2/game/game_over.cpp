@@ -407,6 +407,11 @@ fheroes2::GameMode GameOver::Result::checkGameOver()
 {
     fheroes2::GameMode res = fheroes2::GameMode::CANCEL;
 
+    // An AI benchmark game has no human players and lasts until its day limit regardless of the victory and loss conditions.
+    if ( Game::isAIBenchmark() ) {
+        return res;
+    }
+
     const Settings & conf = Settings::Get();
     const int humanColors = Players::HumanColors();
     const int currentColor = conf.CurrentColor();
@@ -691,6 +691,11 @@ fheroes2::GameMode Interface::AdventureMap::StartGame()
     }
 
     while ( res == fheroes2::GameMode::END_TURN ) {
+        if ( Game::isAIBenchmarkDayLimitReached() ) {
+            res = fheroes2::GameMode::QUIT_GAME;
+            break;
+        }
+
         if ( !loadedFromSave ) {
             world.NewDay();
         }
@@ -958,12 +963,32 @@ fheroes2::GameMode Interface::AdventureMap::HumanTurn( const bool isload )
     bool isCursorOverButtons = false;
     bool isCursorOverGamearea = false;
 
-    const std::vector<Game::DelayType> delayTypes = { Game::CURRENT_HERO_DELAY, Game::MAPS_DELAY };
+    bool isScrollPositionActive = false;
+
+    // Event handling waits for new events until the earliest of these delays is passed so only delays of running animations must be present here.
+    std::vector<Game::DelayType> delayTypes;
 
     LocalEvent & le = LocalEvent::Get();
     Cursor & cursor = Cursor::Get();
 
     while ( res == fheroes2::GameMode::CANCEL ) {
+        delayTypes.clear();
+        delayTypes.push_back( Game::MAPS_DELAY );
+
+        const Heroes * focusedHero = GetFocusHeroes();
+        if ( isMovingHero || heroAnimationFrameCount > 0 || ( focusedHero != nullptr && focusedHero->isMoveEnabled() ) ) {
+            delayTypes.push_back( Game::CURRENT_HERO_DELAY );
+        }
+
+        // Edge scrolling is done without any new events while the mouse cursor stays still.
+        if ( isScrollPositionActive ) {
+            delayTypes.push_back( Game::SCROLL_START_DELAY );
+        }
+
+        if ( ( _gameArea.NeedScroll() && !isMovingHero ) || _gameArea.needDragScrollRedraw() ) {
+            delayTypes.push_back( Game::SCROLL_DELAY );
+        }
+
         if ( !le.HandleEvents( Game::isDelayNeeded( delayTypes ), true ) ) {
             if ( EventExit() == fheroes2::GameMode::QUIT_GAME ) {
                 res = fheroes2::GameMode::QUIT_GAME;
@@ -1090,6 +1115,8 @@ fheroes2::GameMode Interface::AdventureMap::HumanTurn( const bool isload )
             else if ( isScrollBottom( le.GetMouseCursor() ) )
                 scrollPosition |= SCROLL_BOTTOM;
 
+            isScrollPositionActive = ( scrollPosition != SCROLL_NONE );
+
             if ( scrollPosition != SCROLL_NONE ) {
                 if ( Game::validateAnimationDelay( Game::SCROLL_START_DELAY ) ) {
                     if ( fastScrollRepeatCount < fastScrollStartThreshold ) {
@@ -1106,6 +1133,7 @@ fheroes2::GameMode Interface::AdventureMap::HumanTurn( const bool isload )
             }
         }
         else {
+            isScrollPositionActive = false;
             fastScrollRepeatCount = 0;
         }
 
@@ -1338,7 +1366,7 @@ fheroes2::GameMode Interface::AdventureMap::HumanTurn( const bool isload )
             // map objects animation
             if ( Game::validateAnimationDelay( Game::MAPS_DELAY ) ) {
                 Game::updateAdventureMapAnimationIndex();
-                _gameArea.SetRedraw();
+                setRedraw( REDRAW_GAMEAREA_ANIMATION );
             }
 
             if ( needRedraw() ) {
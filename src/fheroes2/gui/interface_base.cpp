@@ -21,6 +21,8 @@
 #include "interface_base.h"
 
 #include "game.h"
+#include "screen.h"
+#include "tools.h"
 #include "ui_tool.h"
 
 namespace Interface
@@ -40,9 +42,28 @@ namespace Interface
 
             setRedraw( REDRAW_GAMEAREA );
         }
+        else if ( _renderState == RenderState::GAME_AREA_ANIMATION ) {
+            // An empty area means that there are no animated objects in the visible part of the game area.
+            if ( _renderRoi.width > 0 && _renderRoi.height > 0 ) {
+                fheroes2::Display::instance().render( _renderRoi );
+            }
+        }
         else {
             fheroes2::Display::instance().render();
         }
+
+        _renderState = RenderState::NONE;
+        _renderRoi = {};
+    }
+
+    void Interface::BaseInterface::addGameAreaAnimationRenderRoi( const fheroes2::Rect & roi )
+    {
+        if ( _renderState == RenderState::FULL ) {
+            return;
+        }
+
+        _renderState = RenderState::GAME_AREA_ANIMATION;
+        _renderRoi = fheroes2::getBoundaryRect( _renderRoi, roi );
     }
 
 }
@@ -54,7 +54,11 @@ namespace Interface
         // The next value is base for Map Editor interface.
         REDRAW_PANEL = 0x100,
 
-        REDRAW_ALL = 0x1FF
+        REDRAW_ALL = 0x1FF,
+
+        // To render only the animated objects of the game area over the previously rendered game area. It is not a part of REDRAW_ALL
+        // as a full game area redraw already includes it.
+        REDRAW_GAMEAREA_ANIMATION = 0x200
     };
 
     class BaseInterface
@@ -136,13 +140,34 @@ namespace Interface
     protected:
         BaseInterface();
 
-        // If display fade-in state is set reset it to false and fade-in the full display image. Otherwise render full display image without fade-in.
+        // If display fade-in state is set reset it to false and fade-in the full display image. Otherwise render full display image without fade-in
+        // or only the area changed by the game area animation if nothing else has been redrawn since the previous rendering.
         void validateFadeInAndRender();
 
+        // Marks that the given area of the game area has been redrawn because of the animation.
+        void addGameAreaAnimationRenderRoi( const fheroes2::Rect & roi );
+
+        // Marks that the full display image has to be rendered.
+        void setFullRender()
+        {
+            _renderState = RenderState::FULL;
+        }
+
         GameArea _gameArea;
         Radar _radar;
         StatusWindow _statusWindow;
 
         uint32_t _redraw{ 0 };
+
+    private:
+        enum class RenderState : uint8_t
+        {
+            NONE,
+            GAME_AREA_ANIMATION,
+            FULL
+        };
+
+        RenderState _renderState{ RenderState::NONE };
+        fheroes2::Rect _renderRoi;
     };
 }
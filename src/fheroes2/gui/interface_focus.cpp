@@ -124,6 +124,9 @@ void Interface::AdventureMap::SetFocus( Castle * castle )
 
     iconsPanel.Select( castle );
     _gameArea.SetCenter( castle->GetCenter() );
+
+    // The castle dialog is likely to be opened next.
+    CastleDialog::prefetchImages( *castle );
     _statusWindow.SetState( StatusType::STATUS_FUNDS );
 
     if ( Game::UpdateSoundsOnFocusUpdate() ) {
@@ -25,17 +25,19 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
-#include <deque>
 #include <list>
-#include <map>
 #include <ostream>
 #include <type_traits>
+#include <vector>
 
 #include "agg_image.h"
 #include "castle.h"
 #include "cursor.h"
 #include "direction.h"
+#include "game.h"
 #include "game_delays.h"
 #include "game_interface.h"
 #include "gamedefs.h"
@@ -56,6 +58,7 @@
 #include "screen.h"
 #include "settings.h"
 #include "skill.h"
+#include "tools.h"
 #include "ui_object_rendering.h"
 #include "world.h"
 
@@ -65,20 +68,174 @@ namespace
 
     static_assert( std::is_trivially_copyable<fheroes2::ObjectRenderingInfo>::value, "This class is not trivially copyable anymore. Add std::move where required." );
 
+    // A queue of images to be rendered on tiles. Tiles are rendered in the order of their positions (see fheroes2::Point comparison).
+    // Images added to the front of the queue of a tile are rendered before the images added to its back, in the reversed order of addition.
+    // The queue keeps its memory after being cleared so no allocations happen once it has grown enough.
+    class TileImageQueue
+    {
+    public:
+        void clear()
+        {
+            _images.clear();
+            _frontOrder = 0;
+            _backOrder = 0;
+        }
+
+        void pushFront( const fheroes2::Point & tilePos, const fheroes2::ObjectRenderingInfo & info )
+        {
+            _images.push_back( { tilePos, --_frontOrder, info } );
+        }
+
+        void pushBack( const fheroes2::Point & tilePos, const fheroes2::ObjectRenderingInfo & info )
+        {
+            _images.push_back( { tilePos, _backOrder++, info } );
+        }
+
+        void render( fheroes2::Image & output, const Interface::GameArea & area )
+        {
+            std::sort( _images.begin(), _images.end(), []( const TileImage & first, const TileImage & second ) {
+                if ( first.tilePos != second.tilePos ) {
+                    return first.tilePos < second.tilePos;
+                }
+
+                return first.order < second.order;
+            } );
+
+            for ( const TileImage & image : _images ) {
+                const fheroes2::ObjectRenderingInfo & info = image.info;
+                area.BlitOnTile( output, fheroes2::AGG::GetICN( info.icnId, info.icnIndex ), info.area, info.imageOffset.x, info.imageOffset.y, image.tilePos,
+                                 info.isFlipped, info.alphaValue );
+            }
+        }
+
+    private:
+        struct TileImage
+        {
+            fheroes2::Point tilePos;
+            int32_t order;
+            fheroes2::ObjectRenderingInfo info;
+        };
+
+        std::vector<TileImage> _images;
+
+        int32_t _frontOrder{ 0 };
+        int32_t _backOrder{ 0 };
+    };
+
     struct TileUnfitRenderObjectInfo
     {
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> bottomImages;
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> bottomBackgroundImages;
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> topImages;
+        void clear()
+        {
+            bottomImages.clear();
+            bottomBackgroundImages.clear();
+            topImages.clear();
+            lowPriorityBottomImages.clear();
+            highPriorityBottomImages.clear();
+            heroBackgroundImages.clear();
+            shadowImages.clear();
+        }
+
+        TileImageQueue bottomImages;
+        TileImageQueue bottomBackgroundImages;
+        TileImageQueue topImages;
+
+        TileImageQueue lowPriorityBottomImages;
+        TileImageQueue highPriorityBottomImages;
+
+        TileImageQueue heroBackgroundImages;
+
+        TileImageQueue shadowImages;
+    };
+
+    // Size of a terrain cache chunk side in tiles.
+    const int32_t terrainChunkSize = 16;
+
+    // Terrain images never change during the game and change rarely in the Editor so they are rendered into chunks of tiles
+    // and every chunk is copied to the game area as one image. Each chunk remembers the terrain image rendered on each of its tiles
+    // so any terrain change is detected and the corresponding tile is rendered again before the chunk is used.
+    class TerrainCache
+    {
+    public:
+        const fheroes2::Image & getChunk( const int32_t chunkX, const int32_t chunkY )
+        {
+            const int32_t worldWidth = world.w();
+            const int32_t worldHeight = world.h();
+
+            if ( worldWidth != _worldWidth || worldHeight != _worldHeight ) {
+                _worldWidth = worldWidth;
+                _worldHeight = worldHeight;
+                _chunkCountX = ( worldWidth + terrainChunkSize - 1 ) / terrainChunkSize;
+
+                const int32_t chunkCountY = ( worldHeight + terrainChunkSize - 1 ) / terrainChunkSize;
+
+                _chunks.clear();
+                _chunks.resize( static_cast<size_t>( _chunkCountX ) * chunkCountY );
+            }
+
+            assert( chunkX >= 0 && chunkX < _chunkCountX && chunkY >= 0 && chunkY * terrainChunkSize < worldHeight );
 
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> lowPriorityBottomImages;
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> highPriorityBottomImages;
+            TerrainChunk & chunk = _chunks[static_cast<size_t>( chunkY ) * _chunkCountX + chunkX];
 
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> heroBackgroundImages;
+            const int32_t offsetX = chunkX * terrainChunkSize;
+            const int32_t offsetY = chunkY * terrainChunkSize;
+            const int32_t width = std::min( terrainChunkSize, worldWidth - offsetX );
+            const int32_t height = std::min( terrainChunkSize, worldHeight - offsetY );
 
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> shadowImages;
+            if ( chunk.image.empty() ) {
+                chunk.image._disableTransformLayer();
+                chunk.image.resize( width * TILEWIDTH, height * TILEWIDTH );
+
+                chunk.tileImageKeys.assign( static_cast<size_t>( width ) * height, noImageKey );
+            }
+
+            uint32_t * tileImageKey = chunk.tileImageKeys.data();
+
+            for ( int32_t y = 0; y < height; ++y ) {
+                for ( int32_t x = 0; x < width; ++x, ++tileImageKey ) {
+                    const Maps::Tiles & tile = world.GetTiles( offsetX + x, offsetY + y );
+                    const uint32_t key = ( static_cast<uint32_t>( tile.getTerrainImageIndex() ) << 2 ) | ( tile.getTerrainFlags() & 0x3 );
+
+                    if ( key == *tileImageKey ) {
+                        continue;
+                    }
+
+                    const fheroes2::Image & tileImage = Maps::getTileSurface( tile );
+                    fheroes2::Copy( tileImage, 0, 0, chunk.image, x * TILEWIDTH, y * TILEWIDTH, TILEWIDTH, TILEWIDTH );
+
+                    *tileImageKey = key;
+                }
+            }
+
+            return chunk.image;
+        }
+
+    private:
+        static constexpr uint32_t noImageKey = UINT32_MAX;
+
+        struct TerrainChunk
+        {
+            fheroes2::Image image;
+            std::vector<uint32_t> tileImageKeys;
+        };
+
+        std::vector<TerrainChunk> _chunks;
+
+        int32_t _worldWidth{ 0 };
+        int32_t _worldHeight{ 0 };
+        int32_t _chunkCountX{ 0 };
     };
 
+    TerrainCache terrainCache;
+
+    // Game area redraws are never nested so the same render queues are reused by all of them to avoid memory allocations.
+    TileUnfitRenderObjectInfo & getTileUnfitRenderObjectInfo()
+    {
+        static TileUnfitRenderObjectInfo tileUnfit;
+        tileUnfit.clear();
+
+        return tileUnfit;
+    }
+
     void populateStaticTileUnfitObjectInfo( TileUnfitRenderObjectInfo & tileUnfit, std::vector<fheroes2::ObjectRenderingInfo> & imageInfo,
                                             std::vector<fheroes2::ObjectRenderingInfo> & shadowInfo, const fheroes2::Point & offset, const uint8_t alphaValue )
     {
@@ -88,26 +245,26 @@ namespace
 
             if ( imagePos.y > 0 ) {
                 if ( imagePos.x < 0 ) {
-                    tileUnfit.bottomBackgroundImages[imagePos + offset].emplace_front( objectInfo );
+                    tileUnfit.bottomBackgroundImages.pushFront( imagePos + offset, objectInfo );
                 }
                 else {
-                    tileUnfit.bottomBackgroundImages[imagePos + offset].emplace_back( objectInfo );
+                    tileUnfit.bottomBackgroundImages.pushBack( imagePos + offset, objectInfo );
                 }
             }
             else if ( imagePos.y == 0 ) {
                 if ( imagePos.x < 0 ) {
-                    tileUnfit.bottomImages[imagePos + offset].emplace_front( objectInfo );
+                    tileUnfit.bottomImages.pushFront( imagePos + offset, objectInfo );
                 }
                 else {
-                    tileUnfit.bottomImages[imagePos + offset].emplace_back( objectInfo );
+                    tileUnfit.bottomImages.pushBack( imagePos + offset, objectInfo );
                 }
             }
             else {
                 if ( imagePos.x < 0 ) {
-                    tileUnfit.topImages[imagePos + offset].emplace_front( objectInfo );
+                    tileUnfit.topImages.pushFront( imagePos + offset, objectInfo );
                 }
                 else {
-                    tileUnfit.topImages[imagePos + offset].emplace_back( objectInfo );
+                    tileUnfit.topImages.pushBack( imagePos + offset, objectInfo );
                 }
             }
         }
@@ -123,7 +280,7 @@ namespace
 
             objectInfo.alphaValue = alphaValue;
 
-            tileUnfit.shadowImages[imagePos].emplace_back( objectInfo );
+            tileUnfit.shadowImages.pushBack( imagePos, objectInfo );
         }
     }
 
@@ -135,13 +292,13 @@ namespace
             objectInfo.alphaValue = alphaValue;
 
             if ( imagePos.y > 0 ) {
-                tileUnfit.bottomBackgroundImages[imagePos + offset].emplace_front( objectInfo );
+                tileUnfit.bottomBackgroundImages.pushFront( imagePos + offset, objectInfo );
             }
             else if ( imagePos.y == 0 ) {
-                tileUnfit.bottomImages[imagePos + offset].emplace_front( objectInfo );
+                tileUnfit.bottomImages.pushFront( imagePos + offset, objectInfo );
             }
             else {
-                tileUnfit.topImages[imagePos + offset].emplace_front( objectInfo );
+                tileUnfit.topImages.pushFront( imagePos + offset, objectInfo );
             }
         }
     }
@@ -180,25 +337,25 @@ namespace
             if ( movingHero && imagePos.y == 0 ) {
                 if ( nextHeroPos.y > heroPos.y && nextHeroPos.x > heroPos.x && imagePos.x > 0 ) {
                     // The hero moves south-east. We need to render it over everything.
-                    tileUnfit.highPriorityBottomImages[imagePos + heroPos].emplace_back( objectInfo );
+                    tileUnfit.highPriorityBottomImages.pushBack( imagePos + heroPos, objectInfo );
                     continue;
                 }
 
                 if ( nextHeroPos.y > heroPos.y && nextHeroPos.x < heroPos.x && imagePos.x < 0 ) {
                     // The hero moves south-west. We need to render it over everything.
-                    tileUnfit.highPriorityBottomImages[imagePos + heroPos].emplace_back( objectInfo );
+                    tileUnfit.highPriorityBottomImages.pushBack( imagePos + heroPos, objectInfo );
                     continue;
                 }
 
                 if ( nextHeroPos.y < heroPos.y && nextHeroPos.x < heroPos.x && imagePos.x < 0 ) {
                     // The hero moves north-west. We need to render it under all other objects.
-                    tileUnfit.lowPriorityBottomImages[imagePos + heroPos].emplace_back( objectInfo );
+                    tileUnfit.lowPriorityBottomImages.pushBack( imagePos + heroPos, objectInfo );
                     continue;
                 }
 
                 if ( nextHeroPos.y < heroPos.y && nextHeroPos.x > heroPos.x && imagePos.x > 0 ) {
                     // The hero moves north-east. We need to render it under all other objects.
-                    tileUnfit.lowPriorityBottomImages[imagePos + heroPos].emplace_back( objectInfo );
+                    tileUnfit.lowPriorityBottomImages.pushBack( imagePos + heroPos, objectInfo );
                     continue;
                 }
             }
@@ -206,13 +363,13 @@ namespace
             if ( movingHero && imagePos.y == 1 ) {
                 if ( nextHeroPos.y > heroPos.y && nextHeroPos.x > heroPos.x && imagePos.x > 0 ) {
                     // The hero moves south-east. We need to render it over everything.
-                    tileUnfit.bottomImages[imagePos + heroPos].emplace_back( objectInfo );
+                    tileUnfit.bottomImages.pushBack( imagePos + heroPos, objectInfo );
                     continue;
                 }
 
                 if ( nextHeroPos.y > heroPos.y && nextHeroPos.x < heroPos.x && imagePos.x < 0 ) {
                     // The hero moves south-west. We need to render it over everything.
-                    tileUnfit.bottomImages[imagePos + heroPos].emplace_back( objectInfo );
+                    tileUnfit.bottomImages.pushBack( imagePos + heroPos, objectInfo );
                     continue;
                 }
             }
@@ -220,13 +377,13 @@ namespace
             if ( movingHero && imagePos.y == -1 ) {
                 if ( nextHeroPos.y < heroPos.y && nextHeroPos.x < heroPos.x && imagePos.x < 0 ) {
                     // The hero moves north-west. We need to render it under all other objects.
-                    tileUnfit.bottomImages[imagePos + heroPos].emplace_back( objectInfo );
+                    tileUnfit.bottomImages.pushBack( imagePos + heroPos, objectInfo );
                     continue;
                 }
 
                 if ( nextHeroPos.y < heroPos.y && nextHeroPos.x > heroPos.x && imagePos.x > 0 ) {
                     // The hero moves north-east. We need to render it under all other objects.
-                    tileUnfit.bottomImages[imagePos + heroPos].emplace_back( objectInfo );
+                    tileUnfit.bottomImages.pushBack( imagePos + heroPos, objectInfo );
                     continue;
                 }
             }
@@ -237,28 +394,28 @@ namespace
                     continue;
                 }
 
-                // The very bottom part of hero (or hero on boat) image should not be rendered before it's shadow so we place it in the extra deque.
+                // The very bottom part of hero (or hero on boat) image should not be rendered before it's shadow so we place it in the extra queue.
                 if ( imagePos.x < 0 ) {
-                    tileUnfit.heroBackgroundImages[imagePos + heroPos].emplace_front( objectInfo );
+                    tileUnfit.heroBackgroundImages.pushFront( imagePos + heroPos, objectInfo );
                 }
                 else {
-                    tileUnfit.heroBackgroundImages[imagePos + heroPos].emplace_back( objectInfo );
+                    tileUnfit.heroBackgroundImages.pushBack( imagePos + heroPos, objectInfo );
                 }
             }
             else if ( imagePos.y == 0 || ( isHeroInCastle && imagePos.y > 0 ) ) {
                 if ( imagePos.x < 0 ) {
-                    tileUnfit.bottomImages[imagePos + heroPos].emplace_front( objectInfo );
+                    tileUnfit.bottomImages.pushFront( imagePos + heroPos, objectInfo );
                 }
                 else {
-                    tileUnfit.bottomImages[imagePos + heroPos].emplace_back( objectInfo );
+                    tileUnfit.bottomImages.pushBack( imagePos + heroPos, objectInfo );
                 }
             }
             else {
                 if ( imagePos.x < 0 ) {
-                    tileUnfit.topImages[imagePos + heroPos].emplace_front( objectInfo );
+                    tileUnfit.topImages.pushFront( imagePos + heroPos, objectInfo );
                 }
                 else {
-                    tileUnfit.topImages[imagePos + heroPos].emplace_back( objectInfo );
+                    tileUnfit.topImages.pushBack( imagePos + heroPos, objectInfo );
                 }
             }
         }
@@ -273,18 +430,7 @@ namespace
 
             objectInfo.alphaValue = heroAlphaValue;
 
-            tileUnfit.shadowImages[imagePos].emplace_back( objectInfo );
-        }
-    }
-
-    void renderImagesOnTiles( fheroes2::Image & output, const std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> & images,
-                              const Interface::GameArea & area )
-    {
-        for ( const auto & [offset, imgInfo] : images ) {
-            for ( const auto & info : imgInfo ) {
-                area.BlitOnTile( output, fheroes2::AGG::GetICN( info.icnId, info.icnIndex ), info.area, info.imageOffset.x, info.imageOffset.y, offset, info.isFlipped,
-                                 info.alphaValue );
-            }
+            tileUnfit.shadowImages.pushBack( imagePos, objectInfo );
         }
     }
 
@@ -337,6 +483,7 @@ void Interface::GameArea::generate( const fheroes2::Size & screenSize, const boo
 void Interface::GameArea::SetAreaPosition( int32_t x, int32_t y, int32_t w, int32_t h )
 {
     _windowROI = { x, y, w, h };
+    _renderClipROI = _windowROI;
     const fheroes2::Size worldSize( world.w() * TILEWIDTH, world.h() * TILEWIDTH );
 
     if ( worldSize.width > w ) {
@@ -369,7 +516,7 @@ void Interface::GameArea::BlitOnTile( fheroes2::Image & dst, const fheroes2::Ima
     const fheroes2::Point tileOffset = GetRelativeTilePosition( mp );
 
     const fheroes2::Rect imageRoi{ tileOffset.x + ox, tileOffset.y + oy, src.width(), src.height() };
-    const fheroes2::Rect overlappedRoi = _windowROI ^ imageRoi;
+    const fheroes2::Rect overlappedRoi = _renderClipROI ^ imageRoi;
 
     fheroes2::AlphaBlit( src, overlappedRoi.x - imageRoi.x, overlappedRoi.y - imageRoi.y, dst, overlappedRoi.x, overlappedRoi.y, overlappedRoi.width,
                          overlappedRoi.height, alpha, flip );
@@ -381,7 +528,7 @@ void Interface::GameArea::BlitOnTile( fheroes2::Image & dst, const fheroes2::Ima
     const fheroes2::Point tileOffset = GetRelativeTilePosition( mp );
 
     const fheroes2::Rect imageRoi{ tileOffset.x + ox, tileOffset.y + oy, srcRoi.width, srcRoi.height };
-    const fheroes2::Rect overlappedRoi = _windowROI ^ imageRoi;
+    const fheroes2::Rect overlappedRoi = _renderClipROI ^ imageRoi;
 
     fheroes2::AlphaBlit( src, srcRoi.x + overlappedRoi.x - imageRoi.x, srcRoi.y + overlappedRoi.y - imageRoi.y, dst, overlappedRoi.x, overlappedRoi.y,
                          overlappedRoi.width, overlappedRoi.height, alpha, flip );
@@ -392,15 +539,125 @@ void Interface::GameArea::DrawTile( fheroes2::Image & dst, const fheroes2::Image
     const fheroes2::Point tileOffset = GetRelativeTilePosition( mp );
 
     const fheroes2::Rect imageRoi{ tileOffset.x, tileOffset.y, src.width(), src.height() };
-    const fheroes2::Rect overlappedRoi = _windowROI ^ imageRoi;
+    const fheroes2::Rect overlappedRoi = _renderClipROI ^ imageRoi;
 
     fheroes2::Copy( src, overlappedRoi.x - imageRoi.x, overlappedRoi.y - imageRoi.y, dst, overlappedRoi.x, overlappedRoi.y, overlappedRoi.width, overlappedRoi.height );
 }
 
 void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzleDraw ) const
 {
-    const fheroes2::Rect & tileROI = GetVisibleTileROI();
+    const fheroes2::Rect tileROI = GetVisibleTileROI();
+
+    if ( tileROI.x >= world.w() || tileROI.y >= world.h() || tileROI.x + tileROI.width <= 0 || tileROI.y + tileROI.height <= 0 ) {
+        // This can't be true! Please check your code changes as we shouldn't have an empty area.
+        assert( 0 );
+        return;
+    }
+
+    _redrawTiles( dst, flag, isPuzzleDraw, tileROI );
+
+    // Puzzle map is rendered without some of the objects so it can't be used as a base for a partial redraw.
+    _lastRedrawState = { _windowROI, _topLeftTileOffset, Game::getAdventureMapAnimationIndex(), isPuzzleDraw ? -1 : flag };
+}
+
+fheroes2::Rect Interface::GameArea::redrawAnimatedObjects( fheroes2::Image & dst, const int flag ) const
+{
+    const uint32_t animationIndex = Game::getAdventureMapAnimationIndex();
+
+    if ( !_animationInfo.empty() || _lastRedrawState.flag != flag || _lastRedrawState.animationIndex + 1 != animationIndex || _lastRedrawState.windowROI != _windowROI
+         || _lastRedrawState.topLeftTileOffset != _topLeftTileOffset ) {
+        Redraw( dst, flag );
+        return _windowROI;
+    }
+
+    const fheroes2::Rect tileROI = GetVisibleTileROI();
+    const bool drawHeroes = ( flag & LEVEL_HEROES ) == LEVEL_HEROES;
+
+    std::vector<uint8_t> dirtyTiles( static_cast<size_t>( tileROI.width ) * tileROI.height, 0 );
+
+    const auto markDirtyTiles = [&tileROI, &dirtyTiles]( const int32_t minX, const int32_t minY, const int32_t maxX, const int32_t maxY ) {
+        for ( int32_t y = std::max( minY, tileROI.y ); y < std::min( maxY, tileROI.y + tileROI.height ); ++y ) {
+            for ( int32_t x = std::max( minX, tileROI.x ); x < std::min( maxX, tileROI.x + tileROI.width ); ++x ) {
+                dirtyTiles[static_cast<size_t>( y - tileROI.y ) * tileROI.width + ( x - tileROI.x )] = 1;
+            }
+        }
+    };
+
+    // Objects outside the visible area can still overlap it: tile-unfit objects are up to 2 tiles wider than a tile on each side and up to 3 tiles taller.
+    const int32_t scanMinX = std::max( tileROI.x - 2, 0 );
+    const int32_t scanMinY = std::max( tileROI.y - 1, 0 );
+    const int32_t scanMaxX = std::min( tileROI.x + tileROI.width + 2, world.w() );
+    const int32_t scanMaxY = std::min( tileROI.y + tileROI.height + 3, world.h() );
+
+    for ( int32_t y = scanMinY; y < scanMaxY; ++y ) {
+        for ( int32_t x = scanMinX; x < scanMaxX; ++x ) {
+            const Maps::Tiles & tile = world.GetTiles( x, y );
+
+            if ( Maps::hasAnimatedTileUnfitObjects( tile, drawHeroes ) ) {
+                markDirtyTiles( x - 2, y - 3, x + 3, y + 2 );
+            }
+            else if ( Maps::hasAnimatedTileFitObjects( tile ) ) {
+                // Flags can go slightly beyond the tile.
+                markDirtyTiles( x - 1, y - 1, x + 2, y + 2 );
+            }
+        }
+    }
+
+    // Join dirty tiles into rectangles: horizontal runs of tiles are merged with the run of the same position and width right above them.
+    std::vector<fheroes2::Rect> dirtyAreas;
+
+    for ( int32_t y = 0; y < tileROI.height; ++y ) {
+        const uint8_t * row = dirtyTiles.data() + static_cast<size_t>( y ) * tileROI.width;
+
+        for ( int32_t x = 0; x < tileROI.width; ) {
+            if ( row[x] == 0 ) {
+                ++x;
+                continue;
+            }
+
+            const int32_t runStartX = x;
+            while ( x < tileROI.width && row[x] != 0 ) {
+                ++x;
+            }
+
+            auto area = std::find_if( dirtyAreas.begin(), dirtyAreas.end(), [runStartX, x, y]( const fheroes2::Rect & rect ) {
+                return rect.x == runStartX && rect.width == x - runStartX && rect.y + rect.height == y;
+            } );
+
+            if ( area != dirtyAreas.end() ) {
+                ++area->height;
+            }
+            else {
+                dirtyAreas.emplace_back( runStartX, y, x - runStartX, 1 );
+            }
+        }
+    }
+
+    fheroes2::Rect redrawnRoi;
+
+    for ( const fheroes2::Rect & area : dirtyAreas ) {
+        const fheroes2::Rect areaTileROI{ tileROI.x + area.x, tileROI.y + area.y, area.width, area.height };
+        const fheroes2::Point areaOffset = GetRelativeTilePosition( areaTileROI.getPosition() );
 
+        _renderClipROI = _windowROI ^ fheroes2::Rect( areaOffset.x, areaOffset.y, area.width * TILEWIDTH, area.height * TILEWIDTH );
+        if ( _renderClipROI.width <= 0 || _renderClipROI.height <= 0 ) {
+            continue;
+        }
+
+        _redrawTiles( dst, flag, false, areaTileROI );
+
+        redrawnRoi = fheroes2::getBoundaryRect( redrawnRoi, _renderClipROI );
+    }
+
+    _renderClipROI = _windowROI;
+
+    _lastRedrawState.animationIndex = animationIndex;
+
+    return redrawnRoi;
+}
+
+void Interface::GameArea::_redrawTiles( fheroes2::Image & dst, const int flag, const bool isPuzzleDraw, const fheroes2::Rect & tileROI ) const
+{
     int32_t minX = tileROI.x;
     int32_t minY = tileROI.y;
     int32_t maxX = tileROI.x + tileROI.width;
@@ -412,7 +669,7 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
     const bool renderFog = ( flag & LEVEL_FOG ) == LEVEL_FOG;
 #endif
 
-    // Render terrain.
+    // Render borders and the empty space around the world.
     for ( int32_t y = 0; y < tileROI.height; ++y ) {
         fheroes2::Point offset( tileROI.x, tileROI.y + y );
 
@@ -426,13 +683,6 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
                 if ( offset.x < 0 || offset.x >= world.w() ) {
                     Maps::redrawEmptyTile( dst, offset, *this );
                 }
-                else {
-                    const Maps::Tiles & tile = world.GetTiles( offset.x, offset.y );
-                    // Do not render terrain on the tiles fully covered with the fog.
-                    if ( tile.getFogDirection() != DIRECTION_ALL || !renderFog ) {
-                        DrawTile( dst, getTileSurface( tile ), offset );
-                    }
-                }
             }
         }
     }
@@ -442,12 +692,18 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
     maxX = std::min( maxX, world.w() );
     maxY = std::min( maxY, world.h() );
 
-    if ( minX >= maxX || minY >= maxY ) {
-        // This can't be true! Please check your code changes as we shouldn't have an empty area.
-        assert( 0 );
-        return;
+    // Render terrain. Tiles fully covered with the fog get the terrain as well: it is cheaper to copy whole chunks and the fog is opaque on them.
+    if ( minX < maxX && minY < maxY ) {
+        for ( int32_t chunkY = minY / terrainChunkSize; chunkY * terrainChunkSize < maxY; ++chunkY ) {
+            for ( int32_t chunkX = minX / terrainChunkSize; chunkX * terrainChunkSize < maxX; ++chunkX ) {
+                DrawTile( dst, terrainCache.getChunk( chunkX, chunkY ), { chunkX * terrainChunkSize, chunkY * terrainChunkSize } );
+            }
+        }
     }
 
+    // The area can contain only tiles outside the world when it is redrawn partially. Objects of the nearby tiles still have to be rendered
+    // over them so the rendering is continued.
+
     // Each tile can contain multiple object parts or sprites. Each object part has its own level or in other words layer of rendering.
     // We need to use a correct order of levels to render objects on tiles. The levels are:
     // 0 - main and action objects like mines, forest, castle and etc.
@@ -469,7 +725,7 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
 
     const bool drawHeroes = ( flag & LEVEL_HEROES ) == LEVEL_HEROES;
 
-    TileUnfitRenderObjectInfo tileUnfit;
+    TileUnfitRenderObjectInfo & tileUnfit = getTileUnfitRenderObjectInfo();
 
     const Heroes * currentHero = drawHeroes ? GetFocusHeroes() : nullptr;
 
@@ -590,7 +846,7 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
     }
 
     // Draw the lower part of tile-unfit object's sprite.
-    renderImagesOnTiles( dst, tileUnfit.bottomBackgroundImages, *this );
+    tileUnfit.bottomBackgroundImages.render( dst, *this );
 
     for ( int32_t y = minY; y < maxY; ++y ) {
         for ( int32_t x = minX; x < maxX; ++x ) {
@@ -605,13 +861,13 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
     }
 
     // Draw all shadows from tile-unfit objects.
-    renderImagesOnTiles( dst, tileUnfit.shadowImages, *this );
+    tileUnfit.shadowImages.render( dst, *this );
 
     // Draw the lower part of hero's sprite including boat sprite when it is controlled by hero.
-    renderImagesOnTiles( dst, tileUnfit.heroBackgroundImages, *this );
+    tileUnfit.heroBackgroundImages.render( dst, *this );
 
     // Low priority images are drawn before any other object on this tile.
-    renderImagesOnTiles( dst, tileUnfit.lowPriorityBottomImages, *this );
+    tileUnfit.lowPriorityBottomImages.render( dst, *this );
 
     for ( int32_t y = minY; y < maxY; ++y ) {
         for ( int32_t x = minX; x < maxX; ++x ) {
@@ -627,10 +883,10 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
     }
 
     // Draw middle part of tile-unfit sprites.
-    renderImagesOnTiles( dst, tileUnfit.bottomImages, *this );
+    tileUnfit.bottomImages.render( dst, *this );
 
     // High priority images are drawn after any other object on this tile.
-    renderImagesOnTiles( dst, tileUnfit.highPriorityBottomImages, *this );
+    tileUnfit.highPriorityBottomImages.render( dst, *this );
 
     std::vector<const Maps::TilesAddon *> topLayerTallObjects;
 
@@ -676,7 +932,7 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
     }
 
     // Draw upper part of tile-unfit sprites.
-    renderImagesOnTiles( dst, tileUnfit.topImages, *this );
+    tileUnfit.topImages.render( dst, *this );
 
     // Draw hero's route. It should be drawn on top of everything.
     const bool drawRoutes = ( flag & LEVEL_ROUTES ) != 0;
@@ -204,6 +204,10 @@ namespace Interface
         // Interface::BaseInterface::Redraw() instead to avoid issues in the "no interface" mode
         void Redraw( fheroes2::Image & dst, int flag, bool isPuzzleDraw = false ) const;
 
+        // Redraws only the parts of the game area which have changed after the adventure map animation index was increased by one since
+        // the previous redraw. A full redraw is done if anything else could have changed. Returns the area which has been redrawn.
+        fheroes2::Rect redrawAnimatedObjects( fheroes2::Image & dst, const int flag ) const;
+
         void renderTileAreaSelect( fheroes2::Image & dst, const int32_t startTile, const int32_t endTile ) const;
 
         void BlitOnTile( fheroes2::Image & dst, const fheroes2::Image & src, int32_t ox, int32_t oy, const fheroes2::Point & mp, bool flip, uint8_t alpha ) const;
@@ -267,6 +271,10 @@ namespace Interface
         BaseInterface & _interface;
 
         fheroes2::Rect _windowROI; // visible to draw area of World Map in pixels
+
+        // All images are cropped by this area during rendering. It is the same as the window ROI unless only a part of the game area is redrawn.
+        // This member needs to be mutable because it is modified during rendering.
+        mutable fheroes2::Rect _renderClipROI;
         fheroes2::Point _topLeftTileOffset; // offset of tiles to be drawn (from here we can find any tile ID)
 
         // boundaries for World Map
@@ -286,6 +294,18 @@ namespace Interface
         // This member needs to be mutable because it is modified during rendering.
         mutable std::vector<std::shared_ptr<BaseObjectAnimationInfo>> _animationInfo;
 
+        // The state of the game area at the moment of the previous redraw. It is used to determine whether a partial redraw is possible.
+        struct RedrawState
+        {
+            fheroes2::Rect windowROI;
+            fheroes2::Point topLeftTileOffset;
+            uint32_t animationIndex{ 0 };
+            int flag{ -1 };
+        };
+
+        // This member needs to be mutable because it is modified during rendering.
+        mutable RedrawState _lastRedrawState;
+
         fheroes2::Point _lastMouseDragPosition;
         bool _mouseDraggingInitiated;
         bool _mouseDraggingMovement;
@@ -302,6 +322,9 @@ namespace Interface
         void _setCenterToTile( const fheroes2::Point & tile ); // set center to the middle of tile (input is tile ID)
 
         void updateObjectAnimationInfo() const;
+
+        // Renders the given tiles and all objects overlapping them. Rendering is limited by the render clip ROI.
+        void _redrawTiles( fheroes2::Image & dst, const int flag, const bool isPuzzleDraw, const fheroes2::Rect & tileROI ) const;
     };
 }
 
@@ -181,6 +181,9 @@ void Interface::Radar::Build()
 {
     SetZoom();
     _roi = { 0, 0, world.w(), world.h() };
+
+    // Force the full render of the radar map image for the new map.
+    _tileColors.clear();
 }
 
 void Interface::Radar::SetZoom()
@@ -290,15 +293,44 @@ void Interface::Radar::RedrawObjects( const int32_t playerColor, const ViewWorld
     const bool revealAll = flags == ViewWorldMode::ViewAll;
 #endif
 
+    const int32_t worldWidth = world.w();
+    const int32_t worldHeight = world.h();
+
+    assert( _roi.x >= 0 && _roi.y >= 0 && ( _roi.width + _roi.x ) <= worldWidth && ( _roi.height + _roi.y ) <= worldHeight );
+
     uint8_t * radarImage = _map.image();
+    const int32_t radarWidth = _map.width();
+
+    const size_t tileCount = static_cast<size_t>( worldWidth ) * worldHeight;
+
+    // The adventure map radar renders only the tiles changed in the world since the previous render. The changed tiles have to be
+    // taken on every render, otherwise they would be rendered again after a full render.
+    const bool useChangedTiles = ( _radarType == RadarType::WorldMap ) && ( flags == ViewWorldMode::OnlyVisible );
+
+    std::vector<int32_t> changedTiles;
+    const bool areAllTilesChanged = useChangedTiles && !world.takeChangedTiles( changedTiles );
 
-    assert( _roi.x >= 0 && _roi.y >= 0 && ( _roi.width + _roi.x ) <= world.w() && ( _roi.height + _roi.y ) <= world.h() );
+    const bool isImageReset = areAllTilesChanged || _tileColors.size() != tileCount || _tileColorsPlayerColor != playerColor || _tileColorsMode != flags;
+    if ( isImageReset ) {
+        // The radar map image was rendered for another map or with other settings. Fill it with black color ( 0 ) and render it fully.
+        std::fill( radarImage, radarImage + static_cast<ptrdiff_t>( radarWidth ) * _map.height(), COLOR_BLACK );
 
-    // Fill the radar map with black color ( 0 ) only if we are redrawing the entire map.
-    if ( _roi.x == 0 && _roi.y == 0 && _roi.width == world.w() && _roi.height == world.h() ) {
-        std::fill( radarImage, radarImage + static_cast<ptrdiff_t>( area.width ) * area.height, COLOR_BLACK );
+        _tileColors.assign( tileCount, COLOR_BLACK );
+        _tileColorsPlayerColor = playerColor;
+        _tileColorsMode = flags;
+
+        // Radar image pixels of every tile are located between the offsets of this tile and the next one.
+        _tilePixelOffsets.resize( static_cast<size_t>( worldWidth ) + 1 );
+        for ( int32_t i = 0; i <= worldWidth; ++i ) {
+            _tilePixelOffsets[i] = static_cast<int32_t>( i * _zoom );
+        }
+
+        _roi = { 0, 0, worldWidth, worldHeight };
     }
 
+    // Tiles which should not be rendered become black only when the entire map is redrawn.
+    const bool isFullRedraw = ( _roi.x == 0 && _roi.y == 0 && _roi.width == worldWidth && _roi.height == worldHeight );
+
     const bool revealMines = revealAll || ( flags == ViewWorldMode::ViewMines );
     const bool revealHeroes = revealAll || ( flags == ViewWorldMode::ViewHeroes );
     const bool revealTowns = revealAll || ( flags == ViewWorldMode::ViewTowns );
@@ -306,115 +338,141 @@ void Interface::Radar::RedrawObjects( const int32_t playerColor, const ViewWorld
     const bool revealResources = revealAll || ( flags == ViewWorldMode::ViewResources );
     const bool revealOnlyVisible = revealAll || ( flags == ViewWorldMode::OnlyVisible );
 
-    const int32_t radarWidth = _map.width();
-
-    const bool isZoomIn = _zoom > 1.0;
-
-    const int32_t maxRoiX = _roi.width + _roi.x;
-    const int32_t maxRoiY = _roi.height + _roi.y;
-
-    for ( int32_t y = _roi.y; y < maxRoiY; ++y ) {
-        uint8_t * radarY = radarImage + static_cast<ptrdiff_t>( y * _zoom ) * radarWidth;
-        const ptrdiff_t radarYStep = isZoomIn ? ( static_cast<ptrdiff_t>( ( y + 1 ) * _zoom ) * radarWidth ) : 0;
+    // Returns false if the tile should not be rendered.
+    const auto getTileColor = [=]( const Maps::Tiles & tile, uint8_t & fillColor ) {
+        const bool visibleTile = revealAll || !tile.isFog( playerColor );
 
-        for ( int32_t x = _roi.x; x < maxRoiX; ++x ) {
-            const Maps::Tiles & tile = world.GetTiles( x, y );
-            const bool visibleTile = revealAll || !tile.isFog( playerColor );
-
-            uint8_t fillColor = 0;
-
-            switch ( tile.GetObject( revealOnlyVisible || revealHeroes ) ) {
-            case MP2::OBJ_HEROES: {
-                if ( visibleTile || revealHeroes ) {
-                    const Heroes * hero = world.GetHeroes( tile.GetCenter() );
-                    if ( hero ) {
-                        fillColor = GetPaletteIndexFromColor( hero->GetColor() );
-                        break;
-                    }
+        switch ( tile.GetObject( revealOnlyVisible || revealHeroes ) ) {
+        case MP2::OBJ_HEROES: {
+            if ( visibleTile || revealHeroes ) {
+                const Heroes * hero = world.GetHeroes( tile.GetCenter() );
+                if ( hero ) {
+                    fillColor = GetPaletteIndexFromColor( hero->GetColor() );
+                    break;
                 }
-                continue;
             }
-            case MP2::OBJ_LIGHTHOUSE:
-            case MP2::OBJ_ALCHEMIST_LAB:
-            case MP2::OBJ_MINES:
-            case MP2::OBJ_SAWMILL:
-                // TODO: Why Lighthouse is in this category? Verify the logic!
-                if ( visibleTile || revealMines ) {
-                    fillColor = GetPaletteIndexFromColor( getColorFromTile( tile ) );
+            return false;
+        }
+        case MP2::OBJ_LIGHTHOUSE:
+        case MP2::OBJ_ALCHEMIST_LAB:
+        case MP2::OBJ_MINES:
+        case MP2::OBJ_SAWMILL:
+            // TODO: Why Lighthouse is in this category? Verify the logic!
+            if ( visibleTile || revealMines ) {
+                fillColor = GetPaletteIndexFromColor( getColorFromTile( tile ) );
+                break;
+            }
+            return false;
+        case MP2::OBJ_NON_ACTION_LIGHTHOUSE:
+        case MP2::OBJ_NON_ACTION_ALCHEMIST_LAB:
+        case MP2::OBJ_NON_ACTION_MINES:
+        case MP2::OBJ_NON_ACTION_SAWMILL:
+            // TODO: Why Lighthouse is in this category? Verify the logic!
+            if ( visibleTile || revealMines ) {
+                const int32_t mainTileIndex = Maps::Tiles::getIndexOfMainTile( tile );
+                if ( mainTileIndex >= 0 ) {
+                    fillColor = GetPaletteIndexFromColor( getColorFromTile( world.GetTiles( mainTileIndex ) ) );
                     break;
                 }
-                continue;
-            case MP2::OBJ_NON_ACTION_LIGHTHOUSE:
-            case MP2::OBJ_NON_ACTION_ALCHEMIST_LAB:
-            case MP2::OBJ_NON_ACTION_MINES:
-            case MP2::OBJ_NON_ACTION_SAWMILL:
-                // TODO: Why Lighthouse is in this category? Verify the logic!
-                if ( visibleTile || revealMines ) {
-                    const int32_t mainTileIndex = Maps::Tiles::getIndexOfMainTile( tile );
-                    if ( mainTileIndex >= 0 ) {
-                        fillColor = GetPaletteIndexFromColor( getColorFromTile( world.GetTiles( mainTileIndex ) ) );
-                        break;
+            }
+            return false;
+        case MP2::OBJ_ARTIFACT:
+            if ( visibleTile || revealArtifacts ) {
+                fillColor = COLOR_GRAY;
+                break;
+            }
+            return false;
+        case MP2::OBJ_RESOURCE:
+            if ( visibleTile || revealResources ) {
+                fillColor = COLOR_GRAY;
+                break;
+            }
+            return false;
+        default:
+            if ( visibleTile ) {
+                // Castles and Towns can be partially covered by other non-action objects so we need to rely on special storage of castle's tiles.
+                if ( !getCastleColor( fillColor, tile.GetCenter() ) ) {
+                    // This is a visible tile and not covered by other objects, so fill it with the ground tile data.
+                    if ( tile.isRoad() ) {
+                        fillColor = COLOR_ROAD;
                     }
-                }
-                continue;
-            case MP2::OBJ_ARTIFACT:
-                if ( visibleTile || revealArtifacts ) {
-                    fillColor = COLOR_GRAY;
-                    break;
-                }
-                continue;
-            case MP2::OBJ_RESOURCE:
-                if ( visibleTile || revealResources ) {
-                    fillColor = COLOR_GRAY;
-                    break;
-                }
-                continue;
-            default:
-                if ( visibleTile ) {
-                    // Castles and Towns can be partially covered by other non-action objects so we need to rely on special storage of castle's tiles.
-                    if ( !getCastleColor( fillColor, tile.GetCenter() ) ) {
-                        // This is a visible tile and not covered by other objects, so fill it with the ground tile data.
-                        if ( tile.isRoad() ) {
-                            fillColor = COLOR_ROAD;
-                        }
-                        else {
-                            fillColor = GetPaletteIndexFromGround( tile.GetGround() );
+                    else {
+                        fillColor = GetPaletteIndexFromGround( tile.GetGround() );
 
-                            const MP2::MapObjectType objectType = tile.GetObject();
-                            if ( objectType == MP2::OBJ_MOUNTAINS || objectType == MP2::OBJ_TREES ) {
-                                fillColor += 3;
-                            }
+                        const MP2::MapObjectType objectType = tile.GetObject();
+                        if ( objectType == MP2::OBJ_MOUNTAINS || objectType == MP2::OBJ_TREES ) {
+                            fillColor += 3;
                         }
                     }
                 }
+            }
+            else {
+                if ( revealTowns ) {
+                    getCastleColor( fillColor, tile.GetCenter() );
+                }
                 else {
-                    if ( revealTowns ) {
-                        getCastleColor( fillColor, tile.GetCenter() );
-                    }
-                    else {
-                        // Non visible tile, we have already black radar so skip the render of this tile.
-                        continue;
-                    }
+                    // Non visible tile, skip the render of this tile.
+                    return false;
                 }
             }
+        }
+
+        return true;
+    };
 
-            uint8_t * radarX = radarY + static_cast<ptrdiff_t>( x * _zoom );
-            if ( isZoomIn ) {
-                const uint8_t * radarYEnd = radarImage + radarYStep + static_cast<ptrdiff_t>( x * _zoom );
-                uint8_t * radarXEnd = radarY + static_cast<ptrdiff_t>( ( x + 1 ) * _zoom );
+    const auto renderTile = [this, &getTileColor, radarImage, radarWidth, worldWidth]( const int32_t x, const int32_t y, const bool clearHiddenTile ) {
+        uint8_t fillColor = COLOR_BLACK;
 
-                for ( ; radarX != radarYEnd; radarX += radarWidth, radarXEnd += radarWidth ) {
-                    std::fill( radarX, radarXEnd, fillColor );
-                }
+        if ( !getTileColor( world.GetTiles( x, y ), fillColor ) ) {
+            if ( !clearHiddenTile ) {
+                // Keep the previously rendered color of this tile.
+                return;
             }
-            else {
-                *radarX = fillColor;
+
+            fillColor = COLOR_BLACK;
+        }
+
+        uint8_t & tileColor = _tileColors[static_cast<size_t>( y ) * worldWidth + x];
+        if ( fillColor == tileColor ) {
+            // This tile has not changed since the previous render.
+            return;
+        }
+
+        tileColor = fillColor;
+
+        const int32_t pixelOffsetX = _tilePixelOffsets[x];
+        const int32_t pixelWidth = _tilePixelOffsets[x + 1] - pixelOffsetX;
+
+        uint8_t * radarY = radarImage + static_cast<ptrdiff_t>( _tilePixelOffsets[y] ) * radarWidth + pixelOffsetX;
+        const uint8_t * radarYEnd = radarImage + static_cast<ptrdiff_t>( _tilePixelOffsets[y + 1] ) * radarWidth + pixelOffsetX;
+
+        for ( ; radarY != radarYEnd; radarY += radarWidth ) {
+            std::fill( radarY, radarY + pixelWidth, fillColor );
+        }
+    };
+
+    if ( useChangedTiles && !isImageReset ) {
+        // A changed tile is rendered exactly as during a full render.
+        for ( const int32_t tileIndex : changedTiles ) {
+            renderTile( tileIndex % worldWidth, tileIndex / worldWidth, true );
+        }
+    }
+
+    // The whole map has to be processed only when the image is reset or when the changed tiles are not tracked. A smaller area
+    // is still rendered as requested.
+    if ( !useChangedTiles || isImageReset || !isFullRedraw ) {
+        const int32_t maxRoiX = _roi.width + _roi.x;
+        const int32_t maxRoiY = _roi.height + _roi.y;
+
+        for ( int32_t y = _roi.y; y < maxRoiY; ++y ) {
+            for ( int32_t x = _roi.x; x < maxRoiX; ++x ) {
+                renderTile( x, y, isFullRedraw );
             }
         }
     }
 
     // Reset ROI to full radar image to be able to redraw the mini-map without calling 'SetMapRedraw()'.
-    _roi = { 0, 0, world.w(), world.h() };
+    _roi = { 0, 0, worldWidth, worldHeight };
 }
 
 // Redraw radar cursor. RoiRectangle is a rectangle in tile unit of the current radar view.
@@ -25,6 +25,7 @@
 #define H2INTERFACE_RADAR_H
 
 #include <cstdint>
+#include <vector>
 
 #include "gamedefs.h"
 #include "image.h"
@@ -63,6 +64,7 @@ namespace Interface
         void SetRedraw( const uint32_t redrawMode ) const;
 
         // Set the "need" of render the radar map only in the given 'roi' on next radar Redraw call.
+        // The adventure map radar also renders all tiles marked as changed in the world, see World::markTileAsChanged().
         void SetRenderArea( const fheroes2::Rect & roi );
         void Build();
         void RedrawForViewWorld( const ViewWorld::ZoomROIs & roi, ViewWorldMode mode, const bool renderMapObjects );
@@ -102,6 +104,13 @@ namespace Interface
         BaseInterface & _interface;
 
         fheroes2::Image _map{ RADARWIDTH, RADARWIDTH };
+
+        // Colors of all world tiles rendered on the radar map image. Only tiles with changed colors are rendered again.
+        std::vector<uint8_t> _tileColors;
+        // Radar map image pixel offsets of tile borders for the current zoom.
+        std::vector<int32_t> _tilePixelOffsets;
+        int32_t _tileColorsPlayerColor{ 0 };
+        ViewWorldMode _tileColorsMode{ ViewWorldMode::OnlyVisible };
         fheroes2::MovableSprite _cursorArea;
         fheroes2::Rect _roi;
         double _zoom{ 1.0 };
@@ -34,6 +34,7 @@
 #include "tools.h"
 #include "translations.h"
 #include "ui_font.h"
+#include "ui_text.h"
 
 namespace
 {
@@ -84,7 +85,7 @@ namespace fheroes2
 
     SupportedLanguage getResourceLanguage()
     {
-        const std::vector<uint8_t> & data = ::AGG::getDataFromAggFile( ICN::GetString( ICN::FONT ) );
+        const AGGFileData data = ::AGG::getDataFromAggFile( ICN::GetString( ICN::FONT ) );
         if ( data.empty() ) {
             // How is it possible to run the game without a font?
             assert( 0 );
@@ -269,6 +270,9 @@ namespace fheroes2
         const bool isOriginalResourceLanguage = ( language == SupportedLanguage::English ) || ( language == getResourceLanguage() );
 
         AGG::updateLanguageDependentResources( language, isOriginalResourceLanguage );
+
+        // Character widths depend on the alphabet so all text layouts must be calculated again.
+        clearTextLayoutCache();
     }
 
     SupportedLanguage getCurrentLanguage()
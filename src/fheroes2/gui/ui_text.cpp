@@ -24,6 +24,7 @@
 #include <cassert>
 #include <cstddef>
 #include <deque>
+#include <list>
 #include <memory>
 #include <utility>
 
@@ -31,6 +32,21 @@
 #include "image.h"
 #include "math_base.h"
 
+namespace fheroes2
+{
+    struct TextLayout
+    {
+        // Widths (x) and vertical shifts (y) of text rows limited by the maximum width. See getMultiRowInfo() function.
+        std::deque<Point> offsets;
+
+        // The width used to draw text rows evenly. It is calculated only when the text is drawn for the first time.
+        int32_t drawWidth{ -1 };
+
+        // Row offsets used to draw multi-font text. They are calculated along with the draw width.
+        std::deque<Point> drawOffsets;
+    };
+}
+
 namespace
 {
     const uint8_t lineSeparator = '\n';
@@ -39,6 +55,9 @@ namespace
 
     const uint8_t invalidChar = '?';
 
+    // Dialogs usually have only a few texts so it is enough to keep layouts of the recently used texts.
+    const size_t textLayoutCacheSize = 32;
+
     class CharValidator
     {
     public:
@@ -521,6 +540,49 @@ namespace
 
         return maxWidth;
     }
+
+    // Font type and text length are added to the key to separate texts of a multi-font text from each other.
+    void appendTextLayoutKey( std::string & key, const std::string & text, const fheroes2::FontType fontType )
+    {
+        key += static_cast<char>( fontType.size );
+        key += static_cast<char>( fontType.color );
+
+        const uint32_t textSize = static_cast<uint32_t>( text.size() );
+        key.append( reinterpret_cast<const char *>( &textSize ), sizeof( textSize ) );
+
+        key += text;
+    }
+
+    std::string getTextLayoutKey( const char textType, const int32_t maxWidth )
+    {
+        std::string key( 1, textType );
+        key.append( reinterpret_cast<const char *>( &maxWidth ), sizeof( maxWidth ) );
+
+        return key;
+    }
+
+    // The most recently used layout is at the beginning of the list.
+    std::list<std::pair<std::string, fheroes2::TextLayout>> textLayoutCache;
+
+    // Returns a cached layout for the given key. If there is no such layout a new empty one is added to the cache.
+    fheroes2::TextLayout & getCachedTextLayout( const std::string & key, bool & isNewLayout )
+    {
+        for ( auto iter = textLayoutCache.begin(); iter != textLayoutCache.end(); ++iter ) {
+            if ( iter->first == key ) {
+                textLayoutCache.splice( textLayoutCache.begin(), textLayoutCache, iter );
+                isNewLayout = false;
+                return iter->second;
+            }
+        }
+
+        if ( textLayoutCache.size() >= textLayoutCacheSize ) {
+            textLayoutCache.pop_back();
+        }
+
+        textLayoutCache.emplace_front( key, fheroes2::TextLayout() );
+        isNewLayout = true;
+        return textLayoutCache.front().second;
+    }
 }
 
 namespace fheroes2
@@ -573,10 +635,7 @@ namespace fheroes2
             return 0;
         }
 
-        const int32_t fontHeight = getFontHeight( _fontType.size );
-
-        std::deque<Point> offsets;
-        getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), maxWidth, _fontType, fontHeight, offsets );
+        const std::deque<Point> & offsets = _getLayout( maxWidth ).offsets;
 
         int32_t maxRowWidth = offsets.front().x;
         for ( const Point & point : offsets ) {
@@ -592,12 +651,7 @@ namespace fheroes2
             return 0;
         }
 
-        const int32_t fontHeight = getFontHeight( _fontType.size );
-
-        std::deque<Point> offsets;
-        getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), maxWidth, _fontType, fontHeight, offsets );
-
-        return offsets.back().y + fontHeight;
+        return _getLayout( maxWidth ).offsets.back().y + getFontHeight( _fontType.size );
     }
 
     int32_t Text::rows( const int32_t maxWidth ) const
@@ -606,12 +660,7 @@ namespace fheroes2
             return 0;
         }
 
-        const int32_t fontHeight = getFontHeight( _fontType.size );
-
-        std::deque<Point> offsets;
-        getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), maxWidth, _fontType, fontHeight, offsets );
-
-        return offsets.back().y / fontHeight + 1;
+        return _getLayout( maxWidth ).offsets.back().y / getFontHeight( _fontType.size ) + 1;
     }
 
     void Text::draw( const int32_t x, const int32_t y, Image & output ) const
@@ -639,43 +688,45 @@ namespace fheroes2
 
         const int32_t fontHeight = getFontHeight( _fontType.size );
 
-        std::deque<Point> offsets;
-        getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), maxWidth, _fontType, fontHeight, offsets );
-
-        int32_t xOffset = 0;
-        int32_t correctedWidth = maxWidth;
-        if ( offsets.size() > 1 ) {
-            // This is a multi-line message. Optimize it to fit the text evenly.
-            int32_t startWidth = getMaxWordWidth( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), _fontType );
-            int32_t endWidth = maxWidth;
-            while ( startWidth + 1 < endWidth ) {
-                const int32_t currentWidth = ( endWidth + startWidth ) / 2;
-                std::deque<Point> tempOffsets;
-                getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), currentWidth, _fontType, fontHeight,
-                                 tempOffsets );
-
-                if ( tempOffsets.size() > offsets.size() ) {
-                    startWidth = currentWidth;
-                    continue;
-                }
+        TextLayout & layout = _getLayout( maxWidth );
+
+        if ( layout.drawWidth < 0 ) {
+            int32_t correctedWidth = maxWidth;
+            if ( layout.offsets.size() > 1 ) {
+                // This is a multi-line message. Optimize it to fit the text evenly.
+                int32_t startWidth = getMaxWordWidth( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), _fontType );
+                int32_t endWidth = maxWidth;
+                while ( startWidth + 1 < endWidth ) {
+                    const int32_t currentWidth = ( endWidth + startWidth ) / 2;
+                    std::deque<Point> tempOffsets;
+                    getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), currentWidth, _fontType, fontHeight,
+                                     tempOffsets );
+
+                    if ( tempOffsets.size() > layout.offsets.size() ) {
+                        startWidth = currentWidth;
+                        continue;
+                    }
 
-                correctedWidth = currentWidth;
-                endWidth = currentWidth;
+                    correctedWidth = currentWidth;
+                    endWidth = currentWidth;
+                }
             }
-        }
-        else {
-            // This is a single-line message. Find its length.
-            correctedWidth = width();
+            else {
+                // This is a single-line message. Find its length.
+                correctedWidth = width();
+            }
+
+            layout.drawWidth = correctedWidth;
         }
 
-        assert( correctedWidth <= maxWidth );
+        assert( layout.drawWidth <= maxWidth );
 
         // Center text according to the maximum width.
-        xOffset = ( maxWidth - correctedWidth ) / 2;
+        const int32_t xOffset = ( maxWidth - layout.drawWidth ) / 2;
 
-        offsets.clear();
-        render( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), x + xOffset, y, correctedWidth, output, _fontType, fontHeight,
-                true, offsets );
+        std::deque<Point> offsets;
+        render( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), x + xOffset, y, layout.drawWidth, output, _fontType,
+                fontHeight, true, offsets );
     }
 
     bool Text::empty() const
@@ -723,6 +774,22 @@ namespace fheroes2
         return _text;
     }
 
+    TextLayout & Text::_getLayout( const int32_t maxWidth ) const
+    {
+        std::string key = getTextLayoutKey( 'T', maxWidth );
+        appendTextLayoutKey( key, _text, _fontType );
+
+        bool isNewLayout = false;
+        TextLayout & layout = getCachedTextLayout( key, isNewLayout );
+
+        if ( isNewLayout ) {
+            getMultiRowInfo( reinterpret_cast<const uint8_t *>( _text.data() ), static_cast<int32_t>( _text.size() ), maxWidth, _fontType,
+                             getFontHeight( _fontType.size ), layout.offsets );
+        }
+
+        return layout;
+    }
+
     MultiFontText::~MultiFontText() = default;
 
     void MultiFontText::add( Text text )
@@ -758,13 +825,7 @@ namespace fheroes2
 
     int32_t MultiFontText::width( const int32_t maxWidth ) const
     {
-        const int32_t maxFontHeight = height();
-
-        std::deque<Point> offsets;
-        for ( const Text & text : _texts ) {
-            getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), maxWidth, text._fontType, maxFontHeight,
-                             offsets );
-        }
+        const std::deque<Point> & offsets = _getLayout( maxWidth ).offsets;
 
         int32_t maxRowWidth = offsets.front().x;
         for ( const Point & point : offsets ) {
@@ -776,14 +837,7 @@ namespace fheroes2
 
     int32_t MultiFontText::height( const int32_t maxWidth ) const
     {
-        const int32_t maxFontHeight = height();
-
-        std::deque<Point> offsets;
-        for ( const Text & text : _texts ) {
-            getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), maxWidth, text._fontType, maxFontHeight,
-                             offsets );
-        }
-        return offsets.back().y + maxFontHeight;
+        return _getLayout( maxWidth ).offsets.back().y + height();
     }
 
     int32_t MultiFontText::rows( const int32_t maxWidth ) const
@@ -792,23 +846,12 @@ namespace fheroes2
             return 0;
         }
 
-        const int32_t maxFontHeight = height();
-
-        std::deque<Point> offsets;
-        for ( const Text & text : _texts ) {
-            if ( text._text.empty() ) {
-                continue;
-            }
-
-            getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), maxWidth, text._fontType, maxFontHeight,
-                             offsets );
-        }
-
+        const std::deque<Point> & offsets = _getLayout( maxWidth ).offsets;
         if ( offsets.empty() ) {
             return 0;
         }
 
-        return offsets.back().y / maxFontHeight + 1;
+        return offsets.back().y / height() + 1;
     }
 
     void MultiFontText::draw( const int32_t x, const int32_t y, Image & output ) const
@@ -843,59 +886,64 @@ namespace fheroes2
 
         const int32_t maxFontHeight = height();
 
-        std::deque<Point> offsets;
-        for ( const Text & text : _texts ) {
-            getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), maxWidth, text._fontType, maxFontHeight,
-                             offsets );
-        }
+        TextLayout & layout = _getLayout( maxWidth );
 
-        int32_t xOffset = 0;
-        int32_t correctedWidth = maxWidth;
-        if ( offsets.size() > 1 ) {
-            // This is a multi-line message. Optimize it to fit the text evenly.
-            int32_t startWidth = 1;
-            for ( const Text & text : _texts ) {
-                const int32_t maxWordWidth
-                    = getMaxWordWidth( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), text._fontType );
-                if ( startWidth < maxWordWidth ) {
-                    startWidth = maxWordWidth;
-                }
-            }
-            int32_t endWidth = maxWidth;
-            while ( startWidth + 1 < endWidth ) {
-                const int32_t currentWidth = ( endWidth + startWidth ) / 2;
-                std::deque<Point> tempOffsets;
+        if ( layout.drawWidth < 0 ) {
+            std::deque<Point> offsets = layout.offsets;
+
+            int32_t correctedWidth = maxWidth;
+            if ( offsets.size() > 1 ) {
+                // This is a multi-line message. Optimize it to fit the text evenly.
+                int32_t startWidth = 1;
                 for ( const Text & text : _texts ) {
-                    getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), currentWidth, text._fontType,
-                                     maxFontHeight, tempOffsets );
+                    const int32_t maxWordWidth
+                        = getMaxWordWidth( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), text._fontType );
+                    if ( startWidth < maxWordWidth ) {
+                        startWidth = maxWordWidth;
+                    }
                 }
+                int32_t endWidth = maxWidth;
+                while ( startWidth + 1 < endWidth ) {
+                    const int32_t currentWidth = ( endWidth + startWidth ) / 2;
+                    std::deque<Point> tempOffsets;
+                    for ( const Text & text : _texts ) {
+                        getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), currentWidth,
+                                         text._fontType, maxFontHeight, tempOffsets );
+                    }
+
+                    if ( tempOffsets.size() > offsets.size() ) {
+                        startWidth = currentWidth;
+                        continue;
+                    }
 
-                if ( tempOffsets.size() > offsets.size() ) {
-                    startWidth = currentWidth;
-                    continue;
+                    correctedWidth = currentWidth;
+                    endWidth = currentWidth;
+                    std::swap( offsets, tempOffsets );
                 }
+            }
+            else {
+                // This is a single-line message. Find its length.
+                correctedWidth = width();
+                assert( correctedWidth <= maxWidth );
+            }
 
-                correctedWidth = currentWidth;
-                endWidth = currentWidth;
-                std::swap( offsets, tempOffsets );
+            for ( Point & point : offsets ) {
+                point.x = ( correctedWidth - point.x ) / 2;
             }
 
-            xOffset = ( maxWidth - correctedWidth ) / 2;
-        }
-        else {
-            // This is a single-line message. Find its length and center it according to the maximum width.
-            correctedWidth = width();
-            assert( correctedWidth <= maxWidth );
-            xOffset = ( maxWidth - correctedWidth ) / 2;
+            layout.drawWidth = correctedWidth;
+            layout.drawOffsets = std::move( offsets );
         }
 
-        for ( Point & point : offsets ) {
-            point.x = ( correctedWidth - point.x ) / 2;
-        }
+        // Center text according to the maximum width.
+        const int32_t xOffset = ( maxWidth - layout.drawWidth ) / 2;
+
+        // Offsets are consumed while rendering so a copy of them is used.
+        std::deque<Point> offsets = layout.drawOffsets;
 
-        for ( size_t i = 0; i < _texts.size(); ++i ) {
-            render( reinterpret_cast<const uint8_t *>( _texts[i]._text.data() ), static_cast<int32_t>( _texts[i]._text.size() ), x + xOffset, y, correctedWidth, output,
-                    _texts[i]._fontType, maxFontHeight, false, offsets );
+        for ( const Text & text : _texts ) {
+            render( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), x + xOffset, y, layout.drawWidth, output,
+                    text._fontType, maxFontHeight, false, offsets );
         }
     }
 
@@ -915,6 +963,28 @@ namespace fheroes2
         return output;
     }
 
+    TextLayout & MultiFontText::_getLayout( const int32_t maxWidth ) const
+    {
+        std::string key = getTextLayoutKey( 'M', maxWidth );
+        for ( const Text & text : _texts ) {
+            appendTextLayoutKey( key, text._text, text._fontType );
+        }
+
+        bool isNewLayout = false;
+        TextLayout & layout = getCachedTextLayout( key, isNewLayout );
+
+        if ( isNewLayout ) {
+            const int32_t maxFontHeight = height();
+
+            for ( const Text & text : _texts ) {
+                getMultiRowInfo( reinterpret_cast<const uint8_t *>( text._text.data() ), static_cast<int32_t>( text._text.size() ), maxWidth, text._fontType,
+                                 maxFontHeight, layout.offsets );
+            }
+        }
+
+        return layout;
+    }
+
     bool isFontAvailable( const std::string & text, const FontType fontType )
     {
         if ( text.empty() ) {
@@ -941,4 +1011,9 @@ namespace fheroes2
 
         return true;
     }
+
+    void clearTextLayoutCache()
+    {
+        textLayoutCache.clear();
+    }
 }
@@ -86,6 +86,9 @@ namespace fheroes2
 
     int32_t getFontHeight( const FontSize fontSize );
 
+    // Layout of a multi-line text limited by a maximum width of a line.
+    struct TextLayout;
+
     class TextBase
     {
     public:
@@ -155,6 +158,9 @@ namespace fheroes2
         std::string text() const override;
 
     private:
+        // Returns the layout of the text which is calculated only once for the same text, font and maximum width.
+        TextLayout & _getLayout( const int32_t maxWidth ) const;
+
         std::string _text;
 
         FontType _fontType;
@@ -184,9 +190,15 @@ namespace fheroes2
         std::string text() const override;
 
     private:
+        // Returns the layout of all texts which is calculated only once for the same texts, fonts and maximum width.
+        TextLayout & _getLayout( const int32_t maxWidth ) const;
+
         std::vector<Text> _texts;
     };
 
     // This function is usually useful for text generation on buttons as button font is a separate set of sprites.
     bool isFontAvailable( const std::string & text, const FontType fontType );
+
+    // Layouts of recently used texts are cached. The cache must be cleared every time when font sprites are changed.
+    void clearTextLayoutCache();
 }
@@ -33,10 +33,12 @@
 #include <ostream>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "color.h"
 #include "difficulty.h"
 #include "dir.h"
+#include "file_index.h"
 #include "game_io.h"
 #include "game_over.h"
 #include "logging.h"
@@ -49,6 +51,7 @@
 #include "serialize.h"
 #include "settings.h"
 #include "system.h"
+#include "thread.h"
 #include "tools.h"
 
 namespace
@@ -131,6 +134,13 @@ namespace
 
         return Race::NONE;
     }
+
+    // The information about all found map files is stored on the disk so only new or modified map files have to be parsed
+    // when the list of maps is requested.
+    const uint32_t mapInfoIndexMagic = 0x4D415049;
+    const uint16_t mapInfoIndexVersion = 1;
+
+    using MapInfoIndex = fheroes2::FileIndex<Maps::FileInfo>;
 }
 
 namespace Editor
@@ -202,13 +212,6 @@ void Maps::FileInfo::Reset()
     worldMonth = 0;
 }
 
-bool Maps::FileInfo::ReadSAV( std::string filePath )
-{
-    Reset();
-
-    return Game::LoadSAV2FileInfo( std::move( filePath ), *this );
-}
-
 bool Maps::FileInfo::ReadMP2( const std::string & filePath )
 {
     Reset();
@@ -593,13 +596,61 @@ MapsFileInfoList Maps::PrepareMapsFileInfoList( const bool multi )
 
     const int prefNumOfPlayers = conf.PreferablyCountPlayers();
 
+    const std::string indexPath = Game::GetFileIndexPath( "maps.idx" );
+
+    MapInfoIndex previousIndex;
+    if ( !indexPath.empty() ) {
+        // Reading of the map info depends on the version of the current save file.
+        const Game::SaveFileVersionRestorer versionRestorer( CURRENT_FORMAT_VERSION );
+        previousIndex = fheroes2::loadFileIndex<Maps::FileInfo>( indexPath, mapInfoIndexMagic, mapInfoIndexVersion, CURRENT_FORMAT_VERSION );
+    }
+
+    for ( auto & [path, entry] : previousIndex ) {
+        // Only the basename of the map file is stored with the map info.
+        entry.payload.file = path;
+    }
+
+    MapInfoIndex index;
+
+    // Entries of new or modified map files which have to be parsed.
+    std::vector<std::pair<const std::string *, fheroes2::FileIndexEntry<Maps::FileInfo> *>> changedEntries;
+
     for ( const std::string & mapFile : maps ) {
-        Maps::FileInfo fi;
+        fheroes2::FileIndexEntry<Maps::FileInfo> entry;
 
-        if ( !fi.ReadMP2( mapFile ) ) {
+        if ( !System::GetFileSizeAndModificationTime( mapFile, entry.fileSize, entry.modificationTime ) ) {
             continue;
         }
 
+        const auto previousEntry = previousIndex.find( mapFile );
+        const bool isChanged = ( previousEntry == previousIndex.end() || previousEntry->second.fileSize != entry.fileSize
+                                 || previousEntry->second.modificationTime != entry.modificationTime );
+        if ( !isChanged ) {
+            entry = previousEntry->second;
+        }
+
+        const auto [iter, isInserted] = index.try_emplace( mapFile, std::move( entry ) );
+        if ( isInserted && isChanged ) {
+            changedEntries.emplace_back( &iter->first, &iter->second );
+        }
+    }
+
+    // Map file parsing does not touch any global state so every changed file is parsed by a separate task.
+    MultiThreading::runParallelTasks( changedEntries.size(), [&changedEntries]( const size_t entryId ) {
+        auto & [mapFile, entry] = changedEntries[entryId];
+        entry->isValid = entry->payload.ReadMP2( *mapFile );
+    } );
+
+    const bool isIndexChanged = !changedEntries.empty();
+
+    for ( const std::string & mapFile : maps ) {
+        const auto entry = index.find( mapFile );
+        if ( entry == index.end() || !entry->second.isValid ) {
+            continue;
+        }
+
+        Maps::FileInfo fi = entry->second.payload;
+
         if ( multi ) {
             assert( prefNumOfPlayers > 1 );
 
@@ -623,6 +674,11 @@ MapsFileInfoList Maps::PrepareMapsFileInfoList( const bool multi )
         uniqueMaps.try_emplace( System::GetBasename( mapFile ), std::move( fi ) );
     }
 
+    // Entries of removed map files are dropped as well.
+    if ( !indexPath.empty() && ( isIndexChanged || index.size() != previousIndex.size() ) ) {
+        fheroes2::saveFileIndex( indexPath, mapInfoIndexMagic, mapInfoIndexVersion, CURRENT_FORMAT_VERSION, index );
+    }
+
     MapsFileInfoList result;
     result.reserve( uniqueMaps.size() );
 
@@ -54,7 +54,6 @@ namespace Maps
         FileInfo & operator=( FileInfo && ) = default;
 
         bool ReadMP2( const std::string & filePath );
-        bool ReadSAV( std::string filePath );
 
         bool operator==( const FileInfo & fi ) const
         {
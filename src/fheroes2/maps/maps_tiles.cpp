@@ -484,7 +484,9 @@ void Maps::Tiles::Init( int32_t index, const MP2::mp2tile_t & mp2 )
     _boatOwnerColor = Color::NONE;
     _index = index;
 
-    SetObject( static_cast<MP2::MapObjectType>( mp2.mapObjectType ) );
+    // Do not use SetObject() here: the tile may not belong to the world (e.g. during map file parsing)
+    // and the world resets all pathfinders once the map is loaded.
+    _mainObjectType = static_cast<MP2::MapObjectType>( mp2.mapObjectType );
 
     if ( !MP2::doesObjectContainMetadata( _mainObjectType ) && ( _metadata[0] != 0 ) ) {
         // No metadata should exist for non-action objects.
@@ -603,7 +605,8 @@ void Maps::Tiles::SetObject( const MP2::MapObjectType objectType )
 {
     _mainObjectType = objectType;
 
-    world.resetPathfinder();
+    world.updatePathfinder( _index );
+    world.markTileAsChanged( _index );
 }
 
 void Maps::Tiles::setBoat( const int direction, const int color )
@@ -1129,6 +1132,8 @@ void Maps::Tiles::SetObjectPassable( bool pass )
             _tilePassabilityDirections |= Direction::TOP_LEFT;
         else
             _tilePassabilityDirections &= ~Direction::TOP_LEFT;
+
+        world.updatePathfinder( _index );
         break;
 
     default:
@@ -1529,12 +1534,19 @@ void Maps::Tiles::updateObjectImageIndex( const uint32_t objectUid, const MP2::O
 
 void Maps::Tiles::ClearFog( const int colors )
 {
+    if ( ( _fogColors & colors ) == 0 ) {
+        // The fog has already been cleared for these colors.
+        return;
+    }
+
     _fogColors &= ~colors;
 
+    world.markTileAsChanged( _index );
+
     // The fog might be cleared even without the hero's movement - for example, the hero can gain a new level of Scouting
     // skill by picking up a Treasure Chest from a nearby tile or buying a map in a Magellan's Maps object using the space
-    // bar button. Reset the pathfinder(s) to make the newly discovered tiles immediately available for this hero.
-    world.resetPathfinder();
+    // bar button. Update the pathfinder(s) to make the newly discovered tiles immediately available for this hero.
+    world.updatePathfinder( _index );
 }
 
 void Maps::Tiles::updateTileObjectIcnIndex( Maps::Tiles & tile, const uint32_t uid, const uint8_t newIndex )
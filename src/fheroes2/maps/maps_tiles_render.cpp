@@ -696,6 +696,54 @@ namespace Maps
         }
     }
 
+    bool hasAnimatedTileFitObjects( const Tiles & tile )
+    {
+        const uint32_t animationIndex = Game::getAdventureMapAnimationIndex();
+
+        // The image has changed if either the current or the previous frame contains an animation sprite.
+        const auto isAnimated = [animationIndex]( const MP2::ObjectIcnType objectIcnType, const uint32_t imageIndex, const bool quantity ) {
+            const int icn = MP2::getIcnIdFromObjectIcnType( objectIcnType );
+
+            return ICN::AnimationFrame( icn, imageIndex, animationIndex, quantity ) > 0 || ICN::AnimationFrame( icn, imageIndex, animationIndex - 1, quantity ) > 0;
+        };
+
+        if ( tile.getObjectIcnType() != MP2::OBJ_ICN_TYPE_UNKNOWN && isAnimated( tile.getObjectIcnType(), tile.GetObjectSpriteIndex(), tile.metadata()[1] != 0 ) ) {
+            return true;
+        }
+
+        for ( const TilesAddon & addon : tile.getBottomLayerAddons() ) {
+            if ( addon._objectIcnType != MP2::OBJ_ICN_TYPE_UNKNOWN && isAnimated( addon._objectIcnType, addon._imageIndex, false ) ) {
+                return true;
+            }
+        }
+
+        for ( const TilesAddon & addon : tile.getTopLayerAddons() ) {
+            if ( addon._objectIcnType != MP2::OBJ_ICN_TYPE_UNKNOWN && isAnimated( addon._objectIcnType, addon._imageIndex, false ) ) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool hasAnimatedTileUnfitObjects( const Tiles & tile, const bool drawHeroes )
+    {
+        switch ( tile.GetObject() ) {
+        case MP2::OBJ_HEROES:
+            // Hero flags are always animated.
+            return drawHeroes;
+        case MP2::OBJ_MONSTER:
+            return true;
+        default:
+            break;
+        }
+
+        // Flying ghosts.
+        const MP2::MapObjectType objectType = tile.GetObject( false );
+
+        return objectType == MP2::OBJ_ABANDONED_MINE || ( objectType == MP2::OBJ_MINES && Maps::getMineSpellIdFromTile( tile ) == Spell::HAUNT );
+    }
+
     std::vector<fheroes2::ObjectRenderingInfo> getMonsterSpritesPerTile( const Tiles & tile )
     {
         assert( tile.GetObject() == MP2::OBJ_MONSTER );
@@ -54,6 +54,12 @@ namespace Maps
 
     void drawByObjectIcnType( const Tiles & tile, fheroes2::Image & output, const Interface::GameArea & area, const MP2::ObjectIcnType objectIcnType );
 
+    // Returns true if the image of any object part which fits into the tile has changed since the previous adventure map animation index.
+    bool hasAnimatedTileFitObjects( const Tiles & tile );
+
+    // Returns true if the tile contains an animated object bigger than a tile: a monster, a hero or flying ghosts.
+    bool hasAnimatedTileUnfitObjects( const Tiles & tile, const bool drawHeroes );
+
     std::vector<fheroes2::ObjectRenderingInfo> getMonsterSpritesPerTile( const Tiles & tile );
     std::vector<fheroes2::ObjectRenderingInfo> getMonsterShadowSpritesPerTile( const Tiles & tile );
     std::vector<fheroes2::ObjectRenderingInfo> getBoatSpritesPerTile( const Tiles & tile );
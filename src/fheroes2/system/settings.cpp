@@ -64,6 +64,7 @@ namespace
         GLOBAL_SHOW_ICONS = 0x00000100,
         GLOBAL_SHOW_BUTTONS = 0x00000200,
         GLOBAL_SHOW_STATUS = 0x00000400,
+        GLOBAL_AI_TURN_STATISTICS = 0x00000800,
         GLOBAL_FULLSCREEN = 0x00008000,
         GLOBAL_3D_AUDIO = 0x00010000,
         GLOBAL_SYSTEM_INFO = 0x00020000,
@@ -96,6 +97,7 @@ Settings::Settings()
     , music_volume( 6 )
     , _musicType( MUSIC_EXTERNAL )
     , _controllerPointerSpeed( 10 )
+    , _imageCacheSize( 0 )
     , heroes_speed( DEFAULT_SPEED_DELAY )
     , ai_speed( DEFAULT_SPEED_DELAY )
     , scroll_speed( SCROLL_SPEED_NORMAL )
@@ -262,6 +264,10 @@ bool Settings::Read( const std::string & filePath )
         _controllerPointerSpeed = std::clamp( config.IntParams( "controller pointer speed" ), 0, 100 );
     }
 
+    if ( config.Exists( "image cache size" ) ) {
+        _imageCacheSize = std::max( config.IntParams( "image cache size" ), 0 );
+    }
+
     if ( config.Exists( "first time game run" ) && config.StrParams( "first time game run" ) == "off" ) {
         resetFirstGameRun();
     }
@@ -307,6 +313,10 @@ bool Settings::Read( const std::string & filePath )
         setAutoSaveAtBeginningOfTurn( config.StrParams( "auto save at the beginning of the turn" ) == "on" );
     }
 
+    if ( config.Exists( "ai turn statistics" ) ) {
+        setAITurnStatistics( config.StrParams( "ai turn statistics" ) == "on" );
+    }
+
     if ( config.Exists( "cursor soft rendering" ) ) {
         if ( config.StrParams( "cursor soft rendering" ) == "on" ) {
             _optGlobal.SetModes( GLOBAL_CURSOR_SOFT_EMULATION );
@@ -443,6 +453,9 @@ std::string Settings::String() const
     os << std::endl << "# controller pointer speed: 0 - 100" << std::endl;
     os << "controller pointer speed = " << _controllerPointerSpeed << std::endl;
 
+    os << std::endl << "# maximum size of decoded images kept in memory, in megabytes: 0 means no limit" << std::endl;
+    os << "image cache size = " << _imageCacheSize << std::endl;
+
     os << std::endl << "# first time game run (show additional hints): on/off" << std::endl;
     os << "first time game run = " << ( _optGlobal.Modes( GLOBAL_FIRST_RUN ) ? "on" : "off" ) << std::endl;
 
@@ -467,6 +480,9 @@ std::string Settings::String() const
     os << std::endl << "# should auto save be performed at the beginning of the turn instead of the end of the turn: on/off" << std::endl;
     os << "auto save at the beginning of the turn = " << ( _optGlobal.Modes( GLOBAL_AUTO_SAVE_AT_BEGINNING_OF_TURN ) ? "on" : "off" ) << std::endl;
 
+    os << std::endl << "# output per-phase timings of every AI turn as JSON lines into the log: on/off" << std::endl;
+    os << "ai turn statistics = " << ( _optGlobal.Modes( GLOBAL_AI_TURN_STATISTICS ) ? "on" : "off" ) << std::endl;
+
     os << std::endl << "# enable cursor software rendering" << std::endl;
     os << "cursor soft rendering = " << ( _optGlobal.Modes( GLOBAL_CURSOR_SOFT_EMULATION ) ? "on" : "off" ) << std::endl;
 
@@ -753,6 +769,16 @@ void Settings::setAutoSaveAtBeginningOfTurn( const bool enable )
     }
 }
 
+void Settings::setAITurnStatistics( const bool enable )
+{
+    if ( enable ) {
+        _optGlobal.SetModes( GLOBAL_AI_TURN_STATISTICS );
+    }
+    else {
+        _optGlobal.ResetModes( GLOBAL_AI_TURN_STATISTICS );
+    }
+}
+
 void Settings::setBattleDamageInfo( const bool enable )
 {
     if ( enable ) {
@@ -830,6 +856,11 @@ bool Settings::isAutoSaveAtBeginningOfTurnEnabled() const
     return _optGlobal.Modes( GLOBAL_AUTO_SAVE_AT_BEGINNING_OF_TURN );
 }
 
+bool Settings::isAITurnStatisticsEnabled() const
+{
+    return _optGlobal.Modes( GLOBAL_AI_TURN_STATISTICS );
+}
+
 bool Settings::isBattleShowDamageInfoEnabled() const
 {
     return _optGlobal.Modes( GLOBAL_BATTLE_SHOW_DAMAGE );
@@ -184,6 +184,7 @@ public:
     bool is3DAudioEnabled() const;
     bool isSystemInfoEnabled() const;
     bool isAutoSaveAtBeginningOfTurnEnabled() const;
+    bool isAITurnStatisticsEnabled() const;
     bool isBattleShowDamageInfoEnabled() const;
     bool isHideInterfaceEnabled() const;
     bool isEvilInterfaceEnabled() const;
@@ -245,6 +246,7 @@ public:
     void setVSync( const bool enable );
     void setSystemInfo( const bool enable );
     void setAutoSaveAtBeginningOfTurn( const bool enable );
+    void setAITurnStatistics( const bool enable );
     void setBattleDamageInfo( const bool enable );
     void setHideInterface( const bool enable );
     void setEvilInterface( const bool enable );
@@ -406,6 +408,12 @@ public:
         return _controllerPointerSpeed;
     }
 
+    // Returns the maximum size of decoded images in megabytes. 0 means no limit.
+    int imageCacheSize() const
+    {
+        return _imageCacheSize;
+    }
+
     void SetMapsFile( const std::string & file )
     {
         current_maps_file.file = file;
@@ -457,6 +465,7 @@ private:
     int music_volume;
     MusicSource _musicType;
     int _controllerPointerSpeed;
+    int _imageCacheSize;
     int heroes_speed;
     int ai_speed;
     int scroll_speed;
@@ -321,6 +321,8 @@ void World::Defaults()
     // this has to be generated before initializing heroes, as campaign-specific heroes start at a higher level and thus have to simulate level ups
     _seed = Rand::Get( std::numeric_limits<uint32_t>::max() );
 
+    _battleRandomGeneratorAlgorithm = Rand::DeterministicRandomGenerator::Algorithm::SPLITMIX64;
+
     // initialize all heroes
     vec_heroes.Init();
 
@@ -364,6 +366,8 @@ void World::Reset()
     heroes_cond_loss = Heroes::UNKNOWN;
 
     _seed = 0;
+
+    markAllTilesAsChanged();
 }
 
 void World::NewMaps( int32_t sw, int32_t sh )
@@ -876,6 +880,10 @@ void World::CaptureObject( int32_t index, int color )
     if ( color & ( Color::ALL | Color::UNUSED ) ) {
         GetTiles( index ).setOwnershipFlag( objectType, color );
     }
+
+    // The radar shows the owner color on all tiles of the object. Objects occupy at most 3 rows above and 1 row below the main tile.
+    const fheroes2::Point position = Maps::GetPoint( index );
+    markTilesAsChanged( { position.x - 3, position.y - 3, 7, 5 } );
 }
 
 int World::ColorCapturedObject( int32_t index ) const
@@ -891,6 +899,9 @@ CapturedObject & World::GetCapturedObject( int32_t index )
 void World::ResetCapturedObjects( int color )
 {
     map_captureobj.ResetColor( color );
+
+    // Objects of the given color are spread over the whole map.
+    markAllTilesAsChanged();
 }
 
 void World::ClearFog( int colors )
@@ -1282,6 +1293,69 @@ void World::resetPathfinder()
     AI::Get().resetPathfinder();
 }
 
+void World::updatePathfinder( const int32_t tileIndex )
+{
+    _pathfinder.invalidateTile( tileIndex );
+    AI::Get().updatePathfinder( tileIndex );
+}
+
+void World::markTileAsChanged( const int32_t tileIndex )
+{
+    if ( _areAllTilesChanged ) {
+        return;
+    }
+
+    assert( tileIndex >= 0 );
+
+    if ( static_cast<size_t>( tileIndex ) >= _isTileChanged.size() ) {
+        // The map size has been changed since the last takeChangedTiles() call.
+        _areAllTilesChanged = true;
+        return;
+    }
+
+    if ( _isTileChanged[tileIndex] == 0 ) {
+        _isTileChanged[tileIndex] = 1;
+        _changedTiles.push_back( tileIndex );
+    }
+}
+
+void World::markTilesAsChanged( const fheroes2::Rect & area )
+{
+    const fheroes2::Rect roi = area ^ fheroes2::Rect( 0, 0, width, height );
+
+    for ( int32_t y = roi.y; y < roi.y + roi.height; ++y ) {
+        for ( int32_t x = roi.x; x < roi.x + roi.width; ++x ) {
+            markTileAsChanged( y * width + x );
+        }
+    }
+}
+
+void World::markAllTilesAsChanged()
+{
+    _areAllTilesChanged = true;
+}
+
+bool World::takeChangedTiles( std::vector<int32_t> & tileIndexes )
+{
+    tileIndexes.clear();
+
+    if ( _areAllTilesChanged ) {
+        _areAllTilesChanged = false;
+        _changedTiles.clear();
+        _isTileChanged.assign( vec_tiles.size(), 0 );
+
+        return false;
+    }
+
+    for ( const int32_t tileIndex : _changedTiles ) {
+        _isTileChanged[tileIndex] = 0;
+    }
+
+    std::swap( tileIndexes, _changedTiles );
+
+    return true;
+}
+
 void World::PostLoad( const bool setTilePassabilities )
 {
     if ( setTilePassabilities ) {
@@ -1312,6 +1386,7 @@ void World::PostLoad( const bool setTilePassabilities )
     }
 
     resetPathfinder();
+    markAllTilesAsChanged();
     ComputeStaticAnalysis();
 }
 
@@ -1440,7 +1515,8 @@ StreamBase & operator<<( StreamBase & msg, const World & w )
     const uint16_t height = static_cast<uint16_t>( w.height );
 
     return msg << width << height << w.vec_tiles << w.vec_heroes << w.vec_castles << w.vec_kingdoms << w._rumors << w.vec_eventsday << w.map_captureobj
-               << w.ultimate_artifact << w.day << w.week << w.month << w.heroes_cond_wins << w.heroes_cond_loss << w.map_objects << w._seed;
+               << w.ultimate_artifact << w.day << w.week << w.month << w.heroes_cond_wins << w.heroes_cond_loss << w.map_objects << w._seed
+               << static_cast<uint8_t>( w._battleRandomGeneratorAlgorithm );
 }
 
 StreamBase & operator>>( StreamBase & msg, World & w )
@@ -1493,6 +1569,19 @@ StreamBase & operator>>( StreamBase & msg, World & w )
 
     msg >> w.map_objects >> w._seed;
 
+    static_assert( LAST_SUPPORTED_FORMAT_VERSION < FORMAT_VERSION_PRE1_1010_RELEASE, "Remove the logic below." );
+    if ( Game::GetVersionOfCurrentSaveFile() < FORMAT_VERSION_PRE1_1010_RELEASE ) {
+        w._battleRandomGeneratorAlgorithm = Rand::DeterministicRandomGenerator::Algorithm::MT19937;
+    }
+    else {
+        uint8_t algorithm = 0;
+        msg >> algorithm;
+
+        w._battleRandomGeneratorAlgorithm = ( algorithm == static_cast<uint8_t>( Rand::DeterministicRandomGenerator::Algorithm::MT19937 ) )
+                                                ? Rand::DeterministicRandomGenerator::Algorithm::MT19937
+                                                : Rand::DeterministicRandomGenerator::Algorithm::SPLITMIX64;
+    }
+
     w.PostLoad( false );
 
     static_assert( LAST_SUPPORTED_FORMAT_VERSION < FORMAT_VERSION_1003_RELEASE, "Remove the logic below." );
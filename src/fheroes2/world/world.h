@@ -24,6 +24,7 @@
 #define H2WORLD_H
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <list>
@@ -43,6 +44,7 @@
 #include "monster.h"
 #include "mp2.h"
 #include "pairs.h"
+#include "rand.h"
 #include "resource.h"
 #include "world_pathfinding.h"
 #include "world_regions.h"
@@ -58,6 +60,16 @@ namespace Route
     class Step;
 }
 
+// Receives all tiles which are accessed for modification. It is used by the Editor to remember the original state of modified tiles.
+class TileModificationListener
+{
+public:
+    virtual ~TileModificationListener() = default;
+
+    // Called right before the tile is returned by a non-constant World::GetTiles() call.
+    virtual void onTileModification( const Maps::Tiles & tile ) = 0;
+};
+
 struct MapObjects : public std::map<uint32_t, MapObjectSimple *>
 {
     MapObjects() = default;
@@ -184,11 +196,7 @@ public:
 
     Maps::Tiles & GetTiles( const int32_t x, const int32_t y )
     {
-#ifdef WITH_DEBUG
-        return vec_tiles.at( y * width + x );
-#else
-        return vec_tiles[y * width + x];
-#endif
+        return GetTiles( y * width + x );
     }
 
     const Maps::Tiles & GetTiles( const int32_t tileId ) const
@@ -203,10 +211,24 @@ public:
     Maps::Tiles & GetTiles( const int32_t tileId )
     {
 #ifdef WITH_DEBUG
-        return vec_tiles.at( tileId );
+        Maps::Tiles & tile = vec_tiles.at( tileId );
 #else
-        return vec_tiles[tileId];
+        Maps::Tiles & tile = vec_tiles[tileId];
 #endif
+
+        if ( _tileModificationListener != nullptr ) {
+            _tileModificationListener->onTileModification( tile );
+        }
+
+        return tile;
+    }
+
+    // Only one listener can be set at a time. Set nullptr to remove the current listener.
+    void setTileModificationListener( TileModificationListener * listener )
+    {
+        assert( listener == nullptr || _tileModificationListener == nullptr );
+
+        _tileModificationListener = listener;
     }
 
     void InitKingdoms()
@@ -344,12 +366,30 @@ public:
     uint32_t getDistance( const Heroes & hero, int targetIndex );
     std::list<Route::Step> getPath( const Heroes & hero, int targetIndex );
     void resetPathfinder();
+    // Should be called every time the object, the passability or the fog of the tile changes, only the affected parts of
+    // the pathfinders' caches will be re-evaluated
+    void updatePathfinder( const int32_t tileIndex );
+
+    // Should be called every time the object, the ownership or the fog of the tile changes. The radar uses these tiles to
+    // update only the changed parts of its image.
+    void markTileAsChanged( const int32_t tileIndex );
+    // Marks all tiles of the given area (in tiles) as changed. The area is clipped by the map borders.
+    void markTilesAsChanged( const fheroes2::Rect & area );
+    void markAllTilesAsChanged();
+    // Moves the indexes of the tiles changed since the previous call into 'tileIndexes'. Returns false (leaving 'tileIndexes'
+    // empty) if all tiles have to be treated as changed.
+    bool takeChangedTiles( std::vector<int32_t> & tileIndexes );
 
     void ComputeStaticAnalysis();
 
     uint32_t GetMapSeed() const;
     uint32_t GetWeekSeed() const;
 
+    Rand::DeterministicRandomGenerator::Algorithm getBattleRandomGeneratorAlgorithm() const
+    {
+        return _battleRandomGeneratorAlgorithm;
+    }
+
     bool isAnyKingdomVisited( const MP2::MapObjectType objectType, const int32_t dstIndex ) const;
 
     void setOldTileQuantityData( const int32_t tileIndex, const uint8_t quantityValue1, const uint8_t quantityValue2, const uint32_t additionalMetadata );
@@ -394,6 +434,9 @@ private:
 
     uint32_t _seed{ 0 }; // Map seed
 
+    // Games saved before the change of the battle random generator keep using the old one to have the same results of battles.
+    Rand::DeterministicRandomGenerator::Algorithm _battleRandomGeneratorAlgorithm{ Rand::DeterministicRandomGenerator::Algorithm::SPLITMIX64 };
+
     // The following fields are not serialized
 
     std::map<uint8_t, Maps::Indexes> _allTeleports; // All indexes of tiles that contain stone liths of a certain type (sprite index)
@@ -402,7 +445,14 @@ private:
     std::vector<MapRegion> _regions;
     PlayerWorldPathfinder _pathfinder;
 
+    // Tiles changed since the last takeChangedTiles() call. The flags are used to add every tile only once.
+    std::vector<int32_t> _changedTiles;
+    std::vector<uint8_t> _isTileChanged;
+    bool _areAllTilesChanged{ true };
+
     std::vector<std::tuple<uint8_t, uint8_t, uint32_t>> _oldTileQuantityData;
+
+    TileModificationListener * _tileModificationListener{ nullptr };
 };
 
 StreamBase & operator<<( StreamBase &, const CapturedObject & );
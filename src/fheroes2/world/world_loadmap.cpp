@@ -400,7 +400,7 @@ bool World::LoadMapMP2( const std::string & filename, const bool isOriginalMp2Fi
         const uint32_t l = fs.get();
         const uint32_t h = fs.get();
 
-        if ( fs.tell() == fs.size() ) {
+        if ( fs.tell() == totalFileSize ) {
             DEBUG_LOG( DBG_GAME, DBG_WARN, "Map file " << filename.c_str() << " is corrupted" )
             return false;
         }
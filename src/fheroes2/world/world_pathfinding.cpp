@@ -24,6 +24,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
+#include <functional>
 #include <memory>
 #include <set>
 #include <tuple>
@@ -33,6 +34,7 @@
 #include <difficulty.h>
 #include <game.h>
 
+#include "ai_turn_statistics.h"
 #include "army.h"
 #include "artifact.h"
 #include "castle.h"
@@ -415,6 +417,12 @@ void WorldPathfinder::reset()
         _cache.clear();
         _cache.resize( worldSize );
 
+        _changedTiles.clear();
+        _isTileChanged.clear();
+        _isTileChanged.resize( worldSize, 0 );
+
+        _nodesToExplore.reserve( worldSize );
+
         const Directions & directions = Direction::All();
         _mapOffset.resize( directions.size() );
 
@@ -423,13 +431,38 @@ void WorldPathfinder::reset()
         }
     }
 
+    _nodesToExplore.clear();
+    clearChangedTiles();
+
     _pathStart = -1;
     _color = Color::NONE;
     _remainingMovePoints = 0;
     _pathfindingSkill = Skill::Level::EXPERT;
 }
 
-void WorldPathfinder::processWorldMap()
+void WorldPathfinder::invalidateTile( const int32_t tileIndex )
+{
+    // There is nothing to invalidate yet
+    if ( _pathStart == -1 ) {
+        return;
+    }
+
+    // The map is being loaded or there are too many changes to repair the cache faster than to re-evaluate it from scratch
+    if ( tileIndex < 0 || static_cast<size_t>( tileIndex ) >= _cache.size() || _changedTiles.size() >= _cache.size() / 16 ) {
+        reset();
+        return;
+    }
+
+    // The same tile might be reported many times between searches, for example when its fog is cleared again and again
+    if ( _isTileChanged[tileIndex] != 0 ) {
+        return;
+    }
+
+    _isTileChanged[tileIndex] = 1;
+    _changedTiles.push_back( tileIndex );
+}
+
+void WorldPathfinder::initializeWorldMapProcessing()
 {
     assert( _cache.size() == world.getSize() && Maps::isValidAbsIndex( _pathStart ) );
 
@@ -437,17 +470,182 @@ void WorldPathfinder::processWorldMap()
         node.reset();
     }
 
+    _nodesToExplore.clear();
+    clearChangedTiles();
+
     _cache[_pathStart] = WorldNode( -1, 0, MP2::OBJ_NONE, _remainingMovePoints );
 
-    std::vector<int> nodesToExplore;
-    nodesToExplore.push_back( _pathStart );
+    queueNode( _pathStart );
+}
 
-    for ( size_t lastProcessedNode = 0; lastProcessedNode < nodesToExplore.size(); ++lastProcessedNode ) {
-        processCurrentNode( nodesToExplore, nodesToExplore[lastProcessedNode] );
+void WorldPathfinder::processQueuedNodes( const int targetIndex )
+{
+    assert( targetIndex == -1 || ( targetIndex >= 0 && static_cast<size_t>( targetIndex ) < _cache.size() ) );
+
+    const auto isNodeReached = [this]( const int nodeIdx ) { return nodeIdx == _pathStart || _cache[nodeIdx]._from != -1; };
+
+    while ( !_nodesToExplore.empty() ) {
+        // Movement penalties are never negative, so as soon as the target node has been reached for less than the cost of any
+        // other queued node, the cost of reaching the target node cannot be decreased anymore
+        if ( targetIndex != -1 && isNodeReached( targetIndex ) && _cache[targetIndex]._cost < _nodesToExplore.front().first ) {
+            return;
+        }
+
+        std::pop_heap( _nodesToExplore.begin(), _nodesToExplore.end(), std::greater<>() );
+
+        const auto [cost, nodeIdx] = _nodesToExplore.back();
+        _nodesToExplore.pop_back();
+
+        // This node was either reached later for a lower cost, or was reset, so this entry is outdated
+        if ( !isNodeReached( nodeIdx ) || _cache[nodeIdx]._cost != cost ) {
+            continue;
+        }
+
+        processCurrentNode( nodeIdx );
+    }
+}
+
+void WorldPathfinder::queueNode( const int nodeIdx )
+{
+    assert( nodeIdx >= 0 && static_cast<size_t>( nodeIdx ) < _cache.size() );
+
+    _nodesToExplore.emplace_back( _cache[nodeIdx]._cost, nodeIdx );
+    std::push_heap( _nodesToExplore.begin(), _nodesToExplore.end(), std::greater<>() );
+}
+
+void WorldPathfinder::processChangedTiles()
+{
+    if ( _changedTiles.empty() ) {
+        return;
+    }
+
+    assert( _cache.size() == world.getSize() && Maps::isValidAbsIndex( _pathStart ) );
+
+    enum NodeState : uint8_t
+    {
+        UNKNOWN,
+        // The result of processing this node could have been changed
+        AFFECTED,
+        // This node was reached through an affected node
+        INVALID,
+        // This node is neither affected nor reached through an affected node
+        VALID,
+        // This node is valid and has already been queued to reach the affected nodes again
+        QUEUED
+    };
+
+    std::vector<uint8_t> nodeStates( _cache.size(), UNKNOWN );
+
+    const auto isJumpTile = []( const int32_t tileIndex ) {
+        const MP2::MapObjectType objectType = world.GetTiles( tileIndex ).GetObject( false );
+
+        return objectType == MP2::OBJ_STONE_LITHS || objectType == MP2::OBJ_WHIRLPOOL;
+    };
+
+    // The result of processing a node depends only on the contents of this node and its adjacent tiles. The only exceptions are teleports
+    // and whirlpools whose endpoints depend on the contents of other tiles, so their changes require a new search.
+    for ( const int32_t tileIndex : _changedTiles ) {
+        if ( isJumpTile( tileIndex ) ) {
+            initializeWorldMapProcessing();
+            return;
+        }
+
+        nodeStates[tileIndex] = AFFECTED;
+
+        for ( const int32_t idx : Maps::getAroundIndexes( tileIndex ) ) {
+            nodeStates[idx] = AFFECTED;
+        }
+    }
+
+    clearChangedTiles();
+
+    if ( nodeStates[_pathStart] == AFFECTED ) {
+        initializeWorldMapProcessing();
+        return;
+    }
+
+    nodeStates[_pathStart] = VALID;
+
+    std::vector<int32_t> nodesOnTheWay;
+
+    for ( size_t idx = 0; idx < nodeStates.size(); ++idx ) {
+        if ( nodeStates[idx] != UNKNOWN ) {
+            continue;
+        }
+
+        nodesOnTheWay.clear();
+
+        int32_t nodeIdx = static_cast<int32_t>( idx );
+
+        while ( nodeStates[nodeIdx] == UNKNOWN && _cache[nodeIdx]._from != -1 ) {
+            nodesOnTheWay.push_back( nodeIdx );
+            nodeIdx = _cache[nodeIdx]._from;
+
+            assert( nodesOnTheWay.size() <= nodeStates.size() );
+        }
+
+        // Nodes that have not been reached are not affected by the changes
+        if ( nodeStates[nodeIdx] == UNKNOWN ) {
+            nodeStates[nodeIdx] = VALID;
+        }
+
+        const NodeState state = ( nodeStates[nodeIdx] == VALID ) ? VALID : INVALID;
+
+        for ( const int32_t nodeOnTheWayIdx : nodesOnTheWay ) {
+            nodeStates[nodeOnTheWayIdx] = state;
+        }
+    }
+
+    // Nodes reached using teleports, whirlpools or spells cannot be easily reached again from their neighbors
+    for ( size_t idx = 0; idx < nodeStates.size(); ++idx ) {
+        if ( nodeStates[idx] != AFFECTED && nodeStates[idx] != INVALID ) {
+            continue;
+        }
+
+        const int32_t nodeIdx = static_cast<int32_t>( idx );
+        const int from = _cache[nodeIdx]._from;
+
+        if ( isJumpTile( nodeIdx ) || ( from != -1 && Maps::GetDirection( from, nodeIdx ) == Direction::UNKNOWN ) ) {
+            initializeWorldMapProcessing();
+            return;
+        }
+    }
+
+    for ( size_t idx = 0; idx < nodeStates.size(); ++idx ) {
+        if ( nodeStates[idx] != AFFECTED && nodeStates[idx] != INVALID ) {
+            continue;
+        }
+
+        const int32_t nodeIdx = static_cast<int32_t>( idx );
+
+        _cache[nodeIdx].reset();
+
+        for ( const int32_t neighborIdx : Maps::getAroundIndexes( nodeIdx ) ) {
+            if ( nodeStates[neighborIdx] != VALID ) {
+                continue;
+            }
+
+            if ( neighborIdx != _pathStart && _cache[neighborIdx]._from == -1 ) {
+                continue;
+            }
+
+            nodeStates[neighborIdx] = QUEUED;
+
+            queueNode( neighborIdx );
+        }
     }
 }
 
-void WorldPathfinder::checkAdjacentNodes( std::vector<int> & nodesToExplore, int currentNodeIdx )
+void WorldPathfinder::clearChangedTiles()
+{
+    for ( const int32_t tileIndex : _changedTiles ) {
+        _isTileChanged[tileIndex] = 0;
+    }
+
+    _changedTiles.clear();
+}
+
+void WorldPathfinder::checkAdjacentNodes( int currentNodeIdx )
 {
     const Directions & directions = Direction::All();
     const WorldNode & currentNode = _cache[currentNodeIdx];
@@ -476,7 +674,7 @@ void WorldPathfinder::checkAdjacentNodes( std::vector<int> & nodesToExplore, int
             newNode._objectID = newTile.GetObject();
             newNode._remainingMovePoints = subtractMovePoints( currentNode._remainingMovePoints, movementPenalty, maxMovePoints );
 
-            nodesToExplore.push_back( newIndex );
+            queueNode( newIndex );
         }
     }
 }
@@ -502,8 +700,13 @@ void PlayerWorldPathfinder::reEvaluateIfNeeded( const Heroes & hero )
     if ( currentSettings != newSettings ) {
         currentSettings = newSettings;
 
-        processWorldMap();
+        initializeWorldMapProcessing();
+    }
+    else {
+        processChangedTiles();
     }
+
+    processQueuedNodes( -1 );
 }
 
 std::list<Route::Step> PlayerWorldPathfinder::buildPath( const int targetIndex ) const
@@ -543,7 +746,7 @@ std::list<Route::Step> PlayerWorldPathfinder::buildPath( const int targetIndex )
     return path;
 }
 
-void PlayerWorldPathfinder::processCurrentNode( std::vector<int> & nodesToExplore, const int currentNodeIdx )
+void PlayerWorldPathfinder::processCurrentNode( const int currentNodeIdx )
 {
     const bool isFirstNode = ( currentNodeIdx == _pathStart );
     const WorldNode & currentNode = _cache[currentNodeIdx];
@@ -582,7 +785,7 @@ void PlayerWorldPathfinder::processCurrentNode( std::vector<int> & nodesToExplor
         }
     }
     else {
-        checkAdjacentNodes( nodesToExplore, currentNodeIdx );
+        checkAdjacentNodes( currentNodeIdx );
     }
 }
 
@@ -607,6 +810,8 @@ void AIWorldPathfinder::reset()
 
 void AIWorldPathfinder::reEvaluateIfNeeded( const Heroes & hero )
 {
+    const AI::TurnPhaseTimer phaseTimer( AI::TurnPhase::PATHFINDING );
+
     const bool isSummonBoatSpellAvailable = [this, &hero]() {
         static const Spell summonBoat( Spell::SUMMONBOAT );
 
@@ -672,37 +877,51 @@ void AIWorldPathfinder::reEvaluateIfNeeded( const Heroes & hero )
     if ( currentSettings != newSettings ) {
         currentSettings = newSettings;
 
-        processWorldMap();
+        initializeWorldMapProcessing();
+    }
+    else {
+        processChangedTiles();
     }
+
+    // The previous search could have been stopped as soon as the target tile was reached, so we have to complete it
+    processQueuedNodes( -1 );
 }
 
 void AIWorldPathfinder::reEvaluateIfNeeded( const int start, const int color, const double armyStrength, const uint8_t skill )
 {
-    auto currentSettings = std::tie( _pathStart, _color, _remainingMovePoints, _pathfindingSkill, _maxMovePointsOnLand, _maxMovePointsOnWater, _armyStrength,
-                                     _isArtifactsBagFull, _isSummonBoatSpellAvailable, _townGateCastleIndex, _townPortalCastleIndexes );
-    const auto newSettings = std::make_tuple( start, color, 0U, skill, 0U, 0U, armyStrength, false, false, -1, std::vector<int32_t>{} );
-
-    if ( currentSettings != newSettings ) {
-        currentSettings = newSettings;
+    const AI::TurnPhaseTimer phaseTimer( AI::TurnPhase::PATHFINDING );
 
-        processWorldMap();
+    if ( updateArmySettings( start, color, armyStrength, skill ) ) {
+        initializeWorldMapProcessing();
+    }
+    else {
+        processChangedTiles();
     }
+
+    // The previous search could have been stopped as soon as the target tile was reached, so we have to complete it
+    processQueuedNodes( -1 );
 }
 
-void AIWorldPathfinder::processWorldMap()
+bool AIWorldPathfinder::updateArmySettings( const int start, const int color, const double armyStrength, const uint8_t skill )
 {
-    assert( _cache.size() == world.getSize() && Maps::isValidAbsIndex( _pathStart ) );
+    auto currentSettings = std::tie( _pathStart, _color, _remainingMovePoints, _pathfindingSkill, _maxMovePointsOnLand, _maxMovePointsOnWater, _armyStrength,
+                                     _isArtifactsBagFull, _isSummonBoatSpellAvailable, _townGateCastleIndex, _townPortalCastleIndexes );
+    const auto newSettings = std::make_tuple( start, color, 0U, skill, 0U, 0U, armyStrength, false, false, -1, std::vector<int32_t>{} );
 
-    for ( WorldNode & node : _cache ) {
-        node.reset();
+    if ( currentSettings == newSettings ) {
+        return false;
     }
 
-    _cache[_pathStart] = WorldNode( -1, 0, MP2::OBJ_NONE, _remainingMovePoints );
+    currentSettings = newSettings;
 
-    std::vector<int> nodesToExplore;
-    nodesToExplore.push_back( _pathStart );
+    return true;
+}
 
-    const auto processTownPortal = [this, &nodesToExplore]( const Spell & spell, const int32_t castleIndex ) {
+void AIWorldPathfinder::initializeWorldMapProcessing()
+{
+    WorldPathfinder::initializeWorldMapProcessing();
+
+    const auto processTownPortal = [this]( const Spell & spell, const int32_t castleIndex ) {
         assert( castleIndex >= 0 && static_cast<size_t>( castleIndex ) < _cache.size() );
         assert( castleIndex != _pathStart && _cache[castleIndex]._from == -1 );
 
@@ -710,7 +929,7 @@ void AIWorldPathfinder::processWorldMap()
         const uint32_t remaining = ( _remainingMovePoints < cost ) ? 0 : _remainingMovePoints - cost;
 
         _cache[castleIndex] = WorldNode( _pathStart, cost, MP2::OBJ_CASTLE, remaining );
-        nodesToExplore.push_back( castleIndex );
+        queueNode( castleIndex );
     };
 
     if ( _townGateCastleIndex != -1 ) {
@@ -724,10 +943,6 @@ void AIWorldPathfinder::processWorldMap()
 
         processTownPortal( Spell::TOWNPORTAL, idx );
     }
-
-    for ( size_t lastProcessedNode = 0; lastProcessedNode < nodesToExplore.size(); ++lastProcessedNode ) {
-        processCurrentNode( nodesToExplore, nodesToExplore[lastProcessedNode] );
-    }
 }
 
 bool AIWorldPathfinder::isMovementAllowed( const int from, const int direction ) const
@@ -735,7 +950,7 @@ bool AIWorldPathfinder::isMovementAllowed( const int from, const int direction )
     return isMovementAllowedForColor( from, direction, _color, _isSummonBoatSpellAvailable );
 }
 
-void AIWorldPathfinder::processCurrentNode( std::vector<int> & nodesToExplore, const int currentNodeIdx )
+void AIWorldPathfinder::processCurrentNode( const int currentNodeIdx )
 {
     const bool isFirstNode = ( currentNodeIdx == _pathStart );
     WorldNode & currentNode = _cache[currentNodeIdx];
@@ -773,7 +988,7 @@ void AIWorldPathfinder::processCurrentNode( std::vector<int> & nodesToExplore, c
     // Check adjacent nodes only if we are either not on the teleport tile, or we got here from another endpoint of this teleport.
     // Do not check them if we came to the tile with a teleport from a neighboring tile (and are going to use it for teleportation).
     if ( teleports.empty() || std::find( teleports.begin(), teleports.end(), currentNode._from ) != teleports.end() ) {
-        checkAdjacentNodes( nodesToExplore, currentNodeIdx );
+        checkAdjacentNodes( currentNodeIdx );
     }
 
     // Special case: movement via teleport
@@ -793,7 +1008,7 @@ void AIWorldPathfinder::processCurrentNode( std::vector<int> & nodesToExplore, c
             teleportNode._objectID = teleportTile.GetObject();
             teleportNode._remainingMovePoints = currentNode._remainingMovePoints;
 
-            nodesToExplore.push_back( teleportIdx );
+            queueNode( teleportIdx );
         }
     }
 }
@@ -1399,7 +1614,18 @@ std::list<Route::Step> AIWorldPathfinder::buildPath( const int targetIndex ) con
 
 uint32_t AIWorldPathfinder::getDistance( int start, int targetIndex, int color, double armyStrength, uint8_t skill )
 {
-    reEvaluateIfNeeded( start, color, armyStrength, skill );
+    assert( targetIndex >= 0 && static_cast<size_t>( targetIndex ) < _cache.size() );
+
+    const AI::TurnPhaseTimer phaseTimer( AI::TurnPhase::PATHFINDING );
+
+    if ( updateArmySettings( start, color, armyStrength, skill ) ) {
+        initializeWorldMapProcessing();
+    }
+    else {
+        processChangedTiles();
+    }
+
+    processQueuedNodes( targetIndex );
 
     return _cache[targetIndex]._cost;
 }
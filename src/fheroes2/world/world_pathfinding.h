@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <list>
+#include <utility>
 #include <vector>
 
 #include "color.h"
@@ -76,16 +77,37 @@ public:
 
     uint32_t getDistance( int targetIndex ) const;
 
+    // Notifies the pathfinder that the object, the passability or the fog of the given tile has been changed. Only the part of
+    // the cache that could be affected by this change will be re-evaluated on the next request.
+    void invalidateTile( const int32_t tileIndex );
+
 protected:
-    virtual void processWorldMap();
-    void checkAdjacentNodes( std::vector<int> & nodesToExplore, int currentNodeIdx );
+    // Resets the cache and queues the starting node(s) of the search. The default implementation can be overridden by a derived class.
+    virtual void initializeWorldMapProcessing();
+
+    // Processes the queued nodes in the order of increasing cost. If 'targetIndex' is a valid tile index, then the processing stops
+    // as soon as the cost of reaching this tile becomes final, and can be resumed later. Otherwise, all the queued nodes are processed.
+    void processQueuedNodes( const int targetIndex );
+
+    // Queues the node to be processed with the cost currently stored in the cache
+    void queueNode( const int nodeIdx );
+
+    // Resets the nodes whose cost could have been affected by the tile changes since the last search (as well as all the nodes
+    // that were reached through them) and queues their unaffected neighbors to reach them again. If this is not possible, then
+    // a new search is started.
+    void processChangedTiles();
+
+    // Forgets all the tile changes since the last search
+    void clearChangedTiles();
+
+    void checkAdjacentNodes( int currentNodeIdx );
 
     // Checks whether moving from the source tile in the specified direction is allowed. The default implementation
     // can be overridden by a derived class.
     virtual bool isMovementAllowed( const int from, const int direction ) const;
 
     // Defines the pathfinding rules and should be implemented by a derived class.
-    virtual void processCurrentNode( std::vector<int> & nodesToExplore, const int currentNodeIdx ) = 0;
+    virtual void processCurrentNode( const int currentNodeIdx ) = 0;
 
     // Returns the maximum number of movement points, depending on whether the movement is performed by land or by
     // water. Should be implemented by a derived class.
@@ -101,6 +123,17 @@ protected:
     std::vector<WorldNode> _cache;
     std::vector<int> _mapOffset;
 
+    // Binary min-heap of the nodes waiting to be processed, each of them is stored along with the cost at the moment it was queued.
+    // An entry is considered outdated if the cost of the corresponding node has changed since then. The queue is not empty only if
+    // the search was stopped before processing the entire map.
+    std::vector<std::pair<uint32_t, int>> _nodesToExplore;
+
+    // Tiles that have been changed since the last search, every tile is present here only once
+    std::vector<int32_t> _changedTiles;
+
+    // Flags of the tiles present in _changedTiles, indexed by tile index
+    std::vector<uint8_t> _isTileChanged;
+
     // Hero properties should be cached here because they can change even if the hero's position does not change,
     // so it should be possible to compare the old values with the new ones to detect the need to recalculate the
     // pathfinder's cache
@@ -130,7 +163,7 @@ public:
 
 private:
     // Follows regular passability rules (for the human player)
-    void processCurrentNode( std::vector<int> & nodesToExplore, const int currentNodeIdx ) override;
+    void processCurrentNode( const int currentNodeIdx ) override;
 
     // Returns the maximum number of movement points. This class is not intended for planning paths passing both on
     // land and on water at the same time, so the maximum number of movement points corresponding to the type of
@@ -177,7 +210,8 @@ public:
     // in principle, then an empty path is returned.
     std::list<Route::Step> buildPath( const int targetIndex ) const;
 
-    // Used for non-hero armies, like castles or monsters
+    // Used for non-hero armies, like castles or monsters. Only the part of the map required to find the distance to the target tile is
+    // processed, subsequent calls with the same parameters resume the search instead of starting a new one.
     uint32_t getDistance( int start, int targetIndex, int color, double armyStrength, uint8_t skill = Skill::Level::EXPERT );
     // Faster, but does not re-evaluate the map (exposed method of the base class)
     using WorldPathfinder::getDistance;
@@ -205,13 +239,16 @@ public:
     void setSpellPointsReserveRatio( const double ratio );
 
 private:
-    void processWorldMap() override;
+    // Updates the cached properties of the army for which the pathfinding is performed. Returns true if any of them have been changed.
+    bool updateArmySettings( const int start, const int color, const double armyStrength, const uint8_t skill );
+
+    void initializeWorldMapProcessing() override;
 
     // Adds special logic for AI-controlled heroes to use Summon Boat spell to overcome water obstacles (if available)
     bool isMovementAllowed( const int from, const int direction ) const override;
 
     // Follows custom passability rules (for the AI)
-    void processCurrentNode( std::vector<int> & nodesToExplore, const int currentNodeIdx ) override;
+    void processCurrentNode( const int currentNodeIdx ) override;
 
     // Returns the maximum number of movement points, depending on whether the movement is performed by land or by
     // water
@@ -112,7 +112,7 @@ int main( int argc, char ** argv )
             return EXIT_FAILURE;
         }
 
-        buf = Music::Xmi2Mid( buf );
+        buf = Music::Xmi2Mid( buf.data(), buf.size() );
         if ( buf.empty() ) {
             std::cerr << "Failed to convert file " << inputFileName << std::endl;
             return EXIT_FAILURE;